@@ -70,6 +70,12 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
 }
 
 //*****************************************************************************
@@ -360,7 +366,7 @@ namespace etl
     difference_t count = (se - sb);
     TIterator2 db = de - count;
 
-    return TIterator2(memmove(db, sb, sizeof(value_t) * count)) + count;
+    return TIterator2(memmove(db, sb, sizeof(value_t) * count));
   }
 #else
   //***************************************************************************
@@ -1088,12 +1094,12 @@ namespace etl
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = etl::move(first[parent]);
+        first[value_index] = ETL_MOVE(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = etl::move(value);
+      first[value_index] = ETL_MOVE(value);
     }
 
     // Adjust Heap Helper
@@ -1110,18 +1116,18 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
+        first[value_index] = ETL_MOVE(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
+        first[value_index] = ETL_MOVE(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      push_heap(first, value_index, top_index, ETL_MOVE(value), compare);
     }
 
     // Is Heap Helper
@@ -1155,10 +1161,10 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
     typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
 
-    value_t value = etl::move(last[-1]);
-    last[-1] = etl::move(first[0]);
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
   }
 
   // Pop Heap
@@ -1177,7 +1183,7 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
   }
 
   // Push Heap
@@ -1205,7 +1211,7 @@ namespace etl
 
     while (true)
     {
-      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
+      private_heap::adjust_heap(first, parent, length, ETL_MOVE(*(first + parent)), compare);
 
       if (parent == 0)
       {
@@ -1423,6 +1429,10 @@ namespace etl
     template <typename TIterator>
     TIterator rotate_general(TIterator first, TIterator middle, TIterator last)
     {
+      // The new position of the first item.
+      TIterator result = first;
+      etl::advance(result, etl::distance(middle, last));
+
       TIterator next = middle;
 
       while (first != next)
@@ -1441,7 +1451,7 @@ namespace etl
         }
       }
 
-      return first;
+      return result;
     }
 
     //*********************************
@@ -1451,13 +1461,13 @@ namespace etl
       typedef typename etl::iterator_traits<TIterator>::value_type value_type;
 
       // Save the first item.
-      value_type temp(etl::move(*first));
+      value_type temp(ETL_MOVE(*first));
 
       // Move the rest.
       TIterator result = etl::move(etl::next(first), last, first);
 
       // Restore the first item in its rotated position.
-      *result = etl::move(temp);
+      *result = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1471,13 +1481,13 @@ namespace etl
 
       // Save the last item.
       TIterator previous = etl::prev(last);
-      value_type temp(etl::move(*previous));
+      value_type temp(ETL_MOVE(*previous));
 
       // Move the rest.
       TIterator result = etl::move_backward(first, previous, last);
 
       // Restore the last item in its rotated position.
-      *first = etl::move(temp);
+      *first = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1488,6 +1498,16 @@ namespace etl
   template<typename TIterator>
   TIterator rotate(TIterator first, TIterator middle, TIterator last)
   {
+    if (first == middle)
+    {
+      return last;
+    }
+
+    if (middle == last)
+    {
+      return first;
+    }
+
     if (etl::next(first) == middle)
     {
       return private_algorithm::rotate_left_by_one(first, last);
@@ -2491,6 +2511,29 @@ namespace etl
 #endif
 
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Random access iterators use intro sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Other iterators use shell sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
   /// Uses user defined comparison.
@@ -2499,7 +2542,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare);
   }
 
   //***************************************************************************
@@ -2509,7 +2552,7 @@ namespace etl
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
@@ -2666,7 +2709,7 @@ namespace etl
         {
           if (!(*itr == value))
           {
-            *first++ = etl::move(*itr);
+            *first++ = ETL_MOVE(*itr);
           }
 
           ++itr;
@@ -2693,7 +2736,7 @@ namespace etl
         {
           if (!predicate(*itr))
           {
-            *first++ = etl::move(*itr);
+            *first++ = ETL_MOVE(*itr);
           }
 
           ++itr;
@@ -3510,6 +3553,284 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  /// Merges two consecutive sorted ranges into one sorted range.
+  /// Does not allocate a buffer; the ranges are merged by binary search and rotation.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void inplace_merge(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length1 = etl::distance(first, middle);
+    difference_t length2 = etl::distance(middle, last);
+
+    while ((length1 != 0) && (length2 != 0))
+    {
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          using ETL_OR_STD::swap; // Allow ADL
+
+          swap(*first, *middle);
+        }
+
+        return;
+      }
+
+      TIterator    cut1 = first;
+      TIterator    cut2 = middle;
+      difference_t length11;
+      difference_t length22;
+
+      // Split the longer range in half and find where its mid point goes in the other.
+      if (length1 > length2)
+      {
+        length11 = length1 / 2;
+        etl::advance(cut1, length11);
+        cut2     = etl::lower_bound(middle, last, *cut1, compare);
+        length22 = etl::distance(middle, cut2);
+      }
+      else
+      {
+        length22 = length2 / 2;
+        etl::advance(cut2, length22);
+        cut1     = etl::upper_bound(first, middle, *cut2, compare);
+        length11 = etl::distance(first, cut1);
+      }
+
+      TIterator new_middle;
+
+      if (cut1 == middle)
+      {
+        new_middle = cut2;
+      }
+      else if (middle == cut2)
+      {
+        new_middle = cut1;
+      }
+      else
+      {
+        new_middle = etl::rotate(cut1, middle, cut2);
+      }
+
+      // Recurse on the smaller half and loop on the larger one.
+      if ((length11 + length22) < ((length1 - length11) + (length2 - length22)))
+      {
+        etl::inplace_merge(first, cut1, new_middle, compare);
+
+        first   = new_middle;
+        middle  = cut2;
+        length1 = length1 - length11;
+        length2 = length2 - length22;
+      }
+      else
+      {
+        etl::inplace_merge(new_middle, cut2, last, compare);
+
+        last    = new_middle;
+        middle  = cut1;
+        length1 = length11;
+        length2 = length22;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Merges two consecutive sorted ranges into one sorted range.
+  /// Does not allocate a buffer; the ranges are merged by binary search and rotation.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void inplace_merge(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::inplace_merge(first, middle, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Partitions at or below this size are finished with insertion sort.
+    //*************************************************************************
+    static ETL_CONSTANT ptrdiff_t intro_sort_threshold = 16;
+
+    //*************************************************************************
+    /// Insertion sort used to finish small intro sort partitions.
+    /// Moves elements rather than rotating them.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_insertion(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        value_t value = ETL_MOVE(*itr);
+        TIterator hole = itr;
+
+        while ((hole != first) && compare(value, *(hole - 1)))
+        {
+          *hole = ETL_MOVE(*(hole - 1));
+          --hole;
+        }
+
+        *hole = ETL_MOVE(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the median of a, b & c to 'result'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_median_to_first(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*a, *b))
+      {
+        if (compare(*b, *c))
+        {
+          etl::iter_swap(result, b);
+        }
+        else if (compare(*a, *c))
+        {
+          etl::iter_swap(result, c);
+        }
+        else
+        {
+          etl::iter_swap(result, a);
+        }
+      }
+      else if (compare(*a, *c))
+      {
+        etl::iter_swap(result, a);
+      }
+      else if (compare(*b, *c))
+      {
+        etl::iter_swap(result, c);
+      }
+      else
+      {
+        etl::iter_swap(result, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Hoare partition around the pivot.
+    /// The median of three selection guarantees that the scans are bounded.
+    /// Elements equal to the pivot are distributed to both sides, so ranges
+    /// with many duplicates still split evenly.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator intro_sort_partition(TIterator first, TIterator last, TIterator pivot, TCompare compare)
+    {
+      while (true)
+      {
+        while (compare(*first, *pivot))
+        {
+          ++first;
+        }
+
+        --last;
+
+        while (compare(*pivot, *last))
+        {
+          --last;
+        }
+
+        if (!(first < last))
+        {
+          return first;
+        }
+
+        etl::iter_swap(first, last);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// The intro sort loop.
+    /// Recurses on the smaller partition and loops on the larger, so the
+    /// stack depth is bounded by log2(n).
+    /// Falls back to heap sort when the depth limit is reached.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, size_t depth_limit, TCompare compare)
+    {
+      while ((last - first) > intro_sort_threshold)
+      {
+        if (depth_limit == 0U)
+        {
+          etl::make_heap(first, last, compare);
+          etl::sort_heap(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        TIterator middle = first + ((last - first) / 2);
+        intro_sort_median_to_first(first, first + 1, middle, last - 1, compare);
+        TIterator cut = intro_sort_partition(first + 1, last, first, compare);
+
+        if ((cut - first) < (last - cut))
+        {
+          intro_sort_loop(first, cut, depth_limit, compare);
+          first = cut;
+        }
+        else
+        {
+          intro_sort_loop(cut, last, depth_limit, compare);
+          last = cut;
+        }
+      }
+
+      intro_sort_insertion(first, last, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using intro sort.
+  /// Quick sort with a median of three pivot, insertion sort for small
+  /// partitions and a heap sort fallback to guarantee O(N log N).
+  /// Requires random access iterators. Does not allocate.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if ((last - first) < 2)
+    {
+      return;
+    }
+
+    // Depth limit is 2 * log2(n).
+    size_t depth_limit = 0U;
+
+    for (typename etl::iterator_traits<TIterator>::difference_type n = (last - first); n > 1; n /= 2)
+    {
+      depth_limit += 2U;
+    }
+
+    private_algorithm::intro_sort_loop(first, last, depth_limit, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using intro sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -121,6 +121,30 @@ namespace etl
       const bool show_base;
     };
 
+    //*********************************
+    struct notation_spec
+    {
+      ETL_CONSTEXPR notation_spec(uint_least8_t notation_)
+        : notation(notation_)
+      {
+      }
+
+      const uint_least8_t notation;
+    };
+
+    //*********************************
+    // The notations for floating point values.
+    //*********************************
+    struct notation
+    {
+      enum
+      {
+        Fixed,
+        Scientific,
+        General
+      };
+    };
+
     //*********************************
     struct left_spec
     {
@@ -171,6 +195,15 @@ namespace etl
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::base_spec hex(16U);
 
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::notation_spec fixed(private_basic_format_spec::notation::Fixed);
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::notation_spec scientific(private_basic_format_spec::notation::Scientific);
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::notation_spec general(private_basic_format_spec::notation::General);
+
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::left_spec left;
 
@@ -215,6 +248,7 @@ namespace etl
       , boolalpha_(false)
       , show_base_(false)
       , fill_(typename TString::value_type(' '))
+      , notation_(private_basic_format_spec::notation::Fixed)
     {
     }
 
@@ -228,7 +262,8 @@ namespace etl
                                     bool left_justified__,
                                     bool boolalpha__,
                                     bool show_base__,
-                                    typename TString::value_type fill__)
+                                    typename TString::value_type fill__,
+                                    uint_least8_t notation__ = private_basic_format_spec::notation::Fixed)
       : base_(base__)
       , width_(width__)
       , precision_(precision__)
@@ -237,6 +272,7 @@ namespace etl
       , boolalpha_(boolalpha__)
       , show_base_(show_base__)
       , fill_(fill__)
+      , notation_(notation__)
     {
     }
 
@@ -253,6 +289,7 @@ namespace etl
       boolalpha_      = false;
       show_base_      = false;
       fill_           = typename TString::value_type(' ');
+      notation_       = private_basic_format_spec::notation::Fixed;
     }
 
     //***************************************************************************
@@ -367,6 +404,74 @@ namespace etl
       return precision_;
     }
 
+    //***************************************************************************
+    /// Floating point values are shown with 'precision' digits after the
+    /// decimal point. This is the default.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& fixed()
+    {
+      notation_ = private_basic_format_spec::notation::Fixed;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Floating point values are shown with one digit before the decimal
+    /// point, 'precision' digits after it and an exponent. i.e. 1.234e+05
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& scientific()
+    {
+      notation_ = private_basic_format_spec::notation::Scientific;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Floating point values are shown with the fewest digits that read back
+    /// as the same value, in fixed notation unless the exponent is very large
+    /// or small. The precision is ignored.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& general()
+    {
+      notation_ = private_basic_format_spec::notation::General;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Gets the fixed notation flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_fixed() const
+    {
+      return notation_ == private_basic_format_spec::notation::Fixed;
+    }
+
+    //***************************************************************************
+    /// Gets the scientific notation flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_scientific() const
+    {
+      return notation_ == private_basic_format_spec::notation::Scientific;
+    }
+
+    //***************************************************************************
+    /// Gets the general notation flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_general() const
+    {
+      return notation_ == private_basic_format_spec::notation::General;
+    }
+
+    //***************************************************************************
+    /// Sets the floating point notation from a stream manipulator.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& notation(private_basic_format_spec::notation_spec spec)
+    {
+      notation_ = spec.notation;
+      return *this;
+    }
+
     //***************************************************************************
     /// Sets the upper case flag.
     /// \return A reference to the basic_format_spec.
@@ -469,7 +574,8 @@ namespace etl
              (lhs.left_justified_ == rhs.left_justified_) &&
              (lhs.boolalpha_ == rhs.boolalpha_) &&
              (lhs.show_base_ == rhs.show_base_) &&
-             (lhs.fill_ == rhs.fill_);
+             (lhs.fill_ == rhs.fill_) &&
+             (lhs.notation_ == rhs.notation_);
     }
 
     //***************************************************************************
@@ -490,6 +596,7 @@ namespace etl
     bool boolalpha_;
     bool show_base_;
     typename TString::value_type fill_;
+    uint_least8_t notation_;
   };
 }
 
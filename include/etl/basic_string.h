@@ -53,6 +53,7 @@ SOFTWARE.
 #include "exception.h"
 #include "binary.h"
 #include "flags.h"
+#include "private/string_search.h"
 
 #ifdef ETL_COMPILER_GCC
 #pragma GCC diagnostic push
@@ -1330,21 +1331,12 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      if ((pos + str.size()) > size())
+      if ((pos > size()) || ((size() - pos) < str.size()))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return to_position(private_string_search::search(p_buffer + pos, p_buffer + size(), str.p_buffer, str.size()));
     }
 
     //*********************************************************************
@@ -1361,16 +1353,12 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
+      if (pos > size())
       {
         return npos;
       }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+
+      return to_position(private_string_search::search(p_buffer + pos, p_buffer + size(), s, etl::strlen(s)));
     }
 
     //*********************************************************************
@@ -1388,16 +1376,12 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
+      if (pos > size())
       {
         return npos;
       }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+
+      return to_position(private_string_search::search(p_buffer + pos, p_buffer + size(), s, n));
     }
 
     //*********************************************************************
@@ -1407,16 +1391,12 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      return to_position(private_string_search::find_char(p_buffer + position, p_buffer + size(), c));
     }
 
     //*********************************************************************
@@ -1532,18 +1512,10 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator i = etl::find(rbegin() + position, rend(), c);
+      const_pointer last = p_buffer + position;
+      const_pointer p    = private_string_search::rfind_char(const_pointer(p_buffer), last, c);
 
-      if (i != rend())
-      {
-        return size() - etl::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return (p == last) ? npos : size_type(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1870,16 +1842,7 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
+        return to_position(private_string_search::find_first_of(p_buffer + position, p_buffer + size(), s, n));
       }
 
       return npos;
@@ -1892,18 +1855,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1941,23 +1893,10 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
+      const_pointer last = p_buffer + position + 1;
+      const_pointer p    = private_string_search::find_last_of(const_pointer(p_buffer), last, s, n);
 
-      return npos;
+      return (p == last) ? npos : size_type(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1974,20 +1913,10 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_pointer last = p_buffer + position + 1;
+      const_pointer p    = private_string_search::rfind_char(const_pointer(p_buffer), last, c);
 
-      while (it != rend())
-      {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p == last) ? npos : size_type(p - p_buffer);
     }
 
     //*********************************************************************
@@ -2020,23 +1949,7 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return to_position(private_string_search::find_first_not_of(p_buffer + position, p_buffer + size(), s, n));
       }
 
       return npos;
@@ -2098,30 +2011,10 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
+      const_pointer last = p_buffer + position + 1;
+      const_pointer p    = private_string_search::find_last_not_of(const_pointer(p_buffer), last, s, n);
 
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p == last) ? npos : size_type(p - p_buffer);
     }
 
     //*********************************************************************
@@ -2277,41 +2170,39 @@ namespace etl
     //*************************************************************************
     int compare(const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2) const
     {
-      while ((first1 != last1) && (first2 != last2))
-      {
-        if (*first1 < *first2)
-        {
-          // Compared character is lower.
-          return -1;
-        }
-        else if (*first1 > *first2)
-        {
-          // Compared character is higher.
-          return 1;
-        }
+      const size_type length1 = size_type(last1 - first1);
+      const size_type length2 = size_type(last2 - first2);
+      const size_type length  = etl::min(length1, length2);
+
+      const size_type i = private_string_search::mismatch(first1, first2, length);
 
-        ++first1;
-        ++first2;
+      if (i != length)
+      {
+        // Compared character is lower or higher.
+        return (first1[i] < first2[i]) ? -1 : 1;
       }
 
       // We reached the end of one or both of the strings.
-      if ((first1 == last1) && (first2 == last2))
+      if (length1 == length2)
       {
         // Same length.
         return 0;
       }
-      else if (first1 == last1)
-      {
-        // Compared string is shorter.
-        return -1;
-      }
       else
       {
-        // Compared string is longer.
-        return 1;
+        // Compared string is shorter or longer.
+        return (length1 < length2) ? -1 : 1;
       }
     }
 
+    //*************************************************************************
+    /// The position of a search result, or npos if it is the end.
+    //*************************************************************************
+    size_type to_position(const_pointer p) const
+    {
+      return (p == (p_buffer + size())) ? npos : size_type(p - p_buffer);
+    }
+
     //*************************************************************************
     /// Clear the unused trailing portion of the string.
     //*************************************************************************
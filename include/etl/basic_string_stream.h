@@ -190,6 +190,15 @@ namespace etl
       return ss;
     }
 
+    //*********************************
+    /// etl::notation_spec from etl::fixed, etl::scientific & etl::general stream manipulators
+    //*********************************
+    friend basic_string_stream& operator <<(basic_string_stream& ss, etl::private_basic_format_spec::notation_spec spec)
+    {
+      ss.spec.notation(spec);
+      return ss;
+    }
+
     //*********************************
     /// etl::left_spec from etl::left stream manipulator
     //*********************************
@@ -1199,6 +1199,226 @@ namespace etl
   }
 #endif
 
+#if ETL_8BIT_SUPPORT
+  //***************************************************************************
+  /// Count leading zeros. 8bit.
+  /// Uses a binary search.
+  /// Returns 8 for zero.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint8_t value)
+  {
+    uint_least8_t count = 0U;
+
+    if (value == 0U)
+    {
+      count = 8U;
+    }
+    else if (value & 0x80U)
+    {
+      count = 0U;
+    }
+    else
+    {
+      count = 1U;
+
+      if ((value & 0xF0U) == 0U)
+      {
+        value <<= 4U;
+        count += 4U;
+      }
+
+      if ((value & 0xC0U) == 0U)
+      {
+        value <<= 2U;
+        count += 2U;
+      }
+
+      count -= (value & 0x80U) >> 7U;
+    }
+
+    return count;
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int8_t value)
+  {
+    return count_leading_zeros(uint8_t(value));
+  }
+#endif
+
+  //***************************************************************************
+  /// Count leading zeros. 16bit.
+  /// Uses a binary search.
+  /// Returns 16 for zero.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint16_t value)
+  {
+    uint_least8_t count = 0U;
+
+    if (value == 0U)
+    {
+      count = 16U;
+    }
+    else if (value & 0x8000U)
+    {
+      count = 0U;
+    }
+    else
+    {
+      count = 1U;
+
+      if ((value & 0xFF00U) == 0U)
+      {
+        value <<= 8U;
+        count += 8U;
+      }
+
+      if ((value & 0xF000U) == 0U)
+      {
+        value <<= 4U;
+        count += 4U;
+      }
+
+      if ((value & 0xC000U) == 0U)
+      {
+        value <<= 2U;
+        count += 2U;
+      }
+
+      count -= (value & 0x8000U) >> 15U;
+    }
+
+    return count;
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int16_t value)
+  {
+    return count_leading_zeros(uint16_t(value));
+  }
+
+  //***************************************************************************
+  /// Count leading zeros. 32bit.
+  /// Uses a binary search.
+  /// Returns 32 for zero.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint32_t value)
+  {
+    uint_least8_t count = 0U;
+
+    if (value == 0UL)
+    {
+      count = 32U;
+    }
+    else if (value & 0x80000000UL)
+    {
+      count = 0U;
+    }
+    else
+    {
+      count = 1U;
+
+      if ((value & 0xFFFF0000UL) == 0UL)
+      {
+        value <<= 16U;
+        count += 16U;
+      }
+
+      if ((value & 0xFF000000UL) == 0UL)
+      {
+        value <<= 8U;
+        count += 8U;
+      }
+
+      if ((value & 0xF0000000UL) == 0UL)
+      {
+        value <<= 4U;
+        count += 4U;
+      }
+
+      if ((value & 0xC0000000UL) == 0UL)
+      {
+        value <<= 2U;
+        count += 2U;
+      }
+
+      count -= uint_least8_t((value & 0x80000000UL) >> 31U);
+    }
+
+    return count;
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int32_t value)
+  {
+    return count_leading_zeros(uint32_t(value));
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Count leading zeros. 64bit.
+  /// Uses a binary search.
+  /// Returns 64 for zero.
+  ///\ingroup binary
+  //***************************************************************************
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(uint64_t value)
+  {
+    uint_least8_t count = 0U;
+
+    if (value == 0ULL)
+    {
+      count = 64U;
+    }
+    else if (value & 0x8000000000000000ULL)
+    {
+      count = 0U;
+    }
+    else
+    {
+      count = 1U;
+
+      if ((value & 0xFFFFFFFF00000000ULL) == 0ULL)
+      {
+        value <<= 32U;
+        count += 32U;
+      }
+
+      if ((value & 0xFFFF000000000000ULL) == 0ULL)
+      {
+        value <<= 16U;
+        count += 16U;
+      }
+
+      if ((value & 0xFF00000000000000ULL) == 0ULL)
+      {
+        value <<= 8U;
+        count += 8U;
+      }
+
+      if ((value & 0xF000000000000000ULL) == 0ULL)
+      {
+        value <<= 4U;
+        count += 4U;
+      }
+
+      if ((value & 0xC000000000000000ULL) == 0ULL)
+      {
+        value <<= 2U;
+        count += 2U;
+      }
+
+      count -= uint_least8_t((value & 0x8000000000000000ULL) >> 63U);
+    }
+
+    return count;
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_leading_zeros(int64_t value)
+  {
+    return count_leading_zeros(uint64_t(value));
+  }
+#endif
+
 #if ETL_8BIT_SUPPORT
   //*****************************************************************************
   /// Binary interleave
@@ -576,56 +576,28 @@ namespace etl
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
-      // Where to start.
-      size_t index;
-      size_t bit;
+      typedef etl::smallest_uint_for_bits<BITS_PER_ELEMENT>::type ctz_t;
 
-      if (SIZE == 1)
-      {
-        index = 0;
-        bit = position;
-      }
-      else
-      {
-        index = position >> log2<BITS_PER_ELEMENT>::value;
-        bit = position & (BITS_PER_ELEMENT - 1);
-      }
-
-      element_t mask = 1 << bit;
+      // Where to start.
+      size_t index = position / BITS_PER_ELEMENT;
+      size_t bit   = position % BITS_PER_ELEMENT;
 
       // For each element in the bitset...
       while (index < SIZE)
       {
-        element_t value = pdata[index];
+        // Look for set bits, ignoring those before the start position.
+        element_t value = state ? pdata[index] : element_t(~pdata[index]);
+        value &= element_t(ALL_SET << bit);
 
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-            (!state && (value != ALL_SET)))
+        if (value != ALL_CLEAR)
         {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
-        {
-          position += (BITS_PER_ELEMENT - bit);
+          position = (index * BITS_PER_ELEMENT) + etl::count_trailing_zeros(ctz_t(value));
+
+          return (position < NBITS) ? position : ibitset::npos;
         }
 
         // Start at the beginning for all other elements.
         bit = 0;
-        mask = 1;
-
         ++index;
       }
 
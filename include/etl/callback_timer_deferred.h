@@ -0,0 +1,480 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_DEFERRED_INCLUDED
+#define ETL_CALLBACK_TIMER_DEFERRED_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "power.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "callback_timer_wheel.h"
+
+///\defgroup callback_timer_deferred Deferred callback timer
+/// A timing wheel callback timer that may be started and stopped from any
+/// thread or interrupt. Requests are posted to a lock-free command queue and
+/// applied by the thread that calls tick().
+///\ingroup timer
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_callback_timer_deferred
+  {
+    //*************************************************************************
+    /// A command posted to the tick thread.
+    //*************************************************************************
+    struct command
+    {
+      enum type
+      {
+        START,
+        START_IMMEDIATE,
+        STOP,
+        SET_PERIOD,
+        SET_MODE
+      };
+
+      uint32_t                   value;
+      etl::timer_wheel::id::type id;
+      uint_least8_t              cmd_type;
+    };
+
+    //*************************************************************************
+    /// A cell in the command ring.
+    /// The sequence number tells the producers and the consumer whose turn it is.
+    //*************************************************************************
+    struct cell
+    {
+      etl::atomic<uint32_t> sequence;
+      command               cmd;
+    };
+
+    //*************************************************************************
+    /// A bounded, lock-free, multiple producer, single consumer command ring.
+    /// Producers claim a cell with a compare and swap on the write index and
+    /// publish it by advancing the cell's sequence number, so a producer that
+    /// is interrupted part way through a push never blocks the others.
+    /// The consumer stops at the first cell that has not been published.
+    //*************************************************************************
+    class command_ring
+    {
+    public:
+
+      //*******************************
+      command_ring(cell* pcells_, uint32_t size_)
+        : pcells(pcells_),
+          mask(size_ - 1U),
+          read_index(0U)
+      {
+      }
+
+      //*******************************
+      /// Empties the ring.
+      /// Called once the cells are constructed.
+      //*******************************
+      void initialise()
+      {
+        for (uint32_t i = 0U; i <= mask; ++i)
+        {
+          pcells[i].sequence.store(i, etl::memory_order_relaxed);
+        }
+
+        read_index = 0U;
+        write_index.store(0U, etl::memory_order_release);
+      }
+
+      //*******************************
+      /// Posts a command. May be called from any thread.
+      /// Returns false if the ring is full.
+      //*******************************
+      bool push(const command& cmd)
+      {
+        uint32_t position = write_index.load(etl::memory_order_relaxed);
+        cell*    pcell;
+
+        while (true)
+        {
+          pcell = &pcells[position & mask];
+
+          const uint32_t sequence   = pcell->sequence.load(etl::memory_order_acquire);
+          const int32_t  difference = int32_t(sequence - position);
+
+          if (difference == 0)
+          {
+            // The cell is free. Try to claim it.
+            if (write_index.compare_exchange_weak(position, position + 1U, etl::memory_order_relaxed))
+            {
+              break;
+            }
+          }
+          else if (difference < 0)
+          {
+            // The consumer has not finished with the cell yet.
+            return false;
+          }
+          else
+          {
+            // Another producer claimed the cell.
+            position = write_index.load(etl::memory_order_relaxed);
+          }
+        }
+
+        pcell->cmd = cmd;
+        pcell->sequence.store(position + 1U, etl::memory_order_release);
+
+        return true;
+      }
+
+      //*******************************
+      /// Takes the next published command. Only called from the tick thread.
+      /// Returns false if there is none.
+      //*******************************
+      bool pop(command& cmd)
+      {
+        cell& c = pcells[read_index & mask];
+
+        const uint32_t sequence = c.sequence.load(etl::memory_order_acquire);
+
+        if (int32_t(sequence - (read_index + 1U)) < 0)
+        {
+          return false;
+        }
+
+        cmd = c.cmd;
+        c.sequence.store(read_index + mask + 1U, etl::memory_order_release);
+        ++read_index;
+
+        return true;
+      }
+
+      //*******************************
+      /// The number of commands that the ring can hold.
+      //*******************************
+      uint32_t capacity() const
+      {
+        return mask + 1U;
+      }
+
+    private:
+
+      cell* const           pcells;
+      const uint32_t        mask;
+      etl::atomic<uint32_t> write_index;
+      uint32_t              read_index;
+    };
+  }
+
+  //***************************************************************************
+  /// Interface for the deferred callback timer.
+  /// start(), stop(), set_period() and set_mode() may be called from any
+  /// thread or interrupt. They never block; they return false if the command
+  /// queue is full. The commands are applied, in the order that they were
+  /// posted, at the start of the next call to tick().
+  /// register_timer(), unregister_timer(), enable() and clear() must be called
+  /// from the thread that calls tick().
+  //***************************************************************************
+  class icallback_timer_deferred
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer_wheel::id::type register_timer(void     (*p_callback_)(),
+                                              uint32_t period_,
+                                              bool     repeating_)
+    {
+      return timers.register_timer(p_callback_, period_, repeating_);
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer_wheel::id::type register_timer(etl::ifunction<void>& callback_,
+                                              uint32_t              period_,
+                                              bool                  repeating_)
+    {
+      return timers.register_timer(callback_, period_, repeating_);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer_wheel::id::type register_timer(etl::delegate<void()>& callback_,
+                                              uint32_t               period_,
+                                              bool                   repeating_)
+    {
+      return timers.register_timer(callback_, period_, repeating_);
+    }
+#endif
+
+    //*******************************************
+    /// Unregister a timer.
+    /// Commands already posted for the timer are applied first.
+    //*******************************************
+    bool unregister_timer(etl::timer_wheel::id::type id_)
+    {
+      process_commands();
+
+      return timers.unregister_timer(id_);
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      timers.enable(state_);
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return timers.is_running();
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    /// Commands already posted are discarded.
+    //*******************************************
+    void clear()
+    {
+      private_callback_timer_deferred::command cmd;
+
+      while (commands.pop(cmd))
+      {
+      }
+
+      timers.clear();
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last call to 'tick'.
+    // Applies the posted commands first.
+    // Returns true if the tick was processed,
+    // false if the timer is disabled.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (timers.is_running())
+      {
+        process_commands();
+
+        return timers.tick(count);
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    /// Returns false if the id is invalid or the command queue is full.
+    //*******************************************
+    bool start(etl::timer_wheel::id::type id_, bool immediate_ = false)
+    {
+      return post(id_, immediate_ ? private_callback_timer_deferred::command::START_IMMEDIATE : private_callback_timer_deferred::command::START, 0U);
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    /// Returns false if the id is invalid or the command queue is full.
+    //*******************************************
+    bool stop(etl::timer_wheel::id::type id_)
+    {
+      return post(id_, private_callback_timer_deferred::command::STOP, 0U);
+    }
+
+    //*******************************************
+    /// Sets a timer's period. The timer is stopped.
+    /// Returns false if the id is invalid or the command queue is full.
+    //*******************************************
+    bool set_period(etl::timer_wheel::id::type id_, uint32_t period_)
+    {
+      return post(id_, private_callback_timer_deferred::command::SET_PERIOD, period_);
+    }
+
+    //*******************************************
+    /// Sets a timer's mode. The timer is stopped.
+    /// Returns false if the id is invalid or the command queue is full.
+    //*******************************************
+    bool set_mode(etl::timer_wheel::id::type id_, bool repeating_)
+    {
+      return post(id_, private_callback_timer_deferred::command::SET_MODE, repeating_ ? 1U : 0U);
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_deferred(etl::icallback_timer_wheel&            timers_,
+                             private_callback_timer_deferred::cell* pcells_,
+                             uint32_t                               COMMAND_QUEUE_SIZE_)
+      : timers(timers_),
+        commands(pcells_, COMMAND_QUEUE_SIZE_)
+    {
+    }
+
+    //*******************************************
+    /// Destructor.
+    //*******************************************
+    ~icallback_timer_deferred()
+    {
+    }
+
+    //*******************************************
+    /// Empties the command queue.
+    /// Called by the derived class, once the queue storage is constructed.
+    //*******************************************
+    void initialise_commands()
+    {
+      commands.initialise();
+    }
+
+  private:
+
+    //*******************************************
+    /// Posts a command for the tick thread.
+    //*******************************************
+    bool post(etl::timer_wheel::id::type id_, uint_least8_t type_, uint32_t value_)
+    {
+      if (id_ >= timers.MAX_TIMERS)
+      {
+        return false;
+      }
+
+      private_callback_timer_deferred::command cmd;
+      cmd.value = value_;
+      cmd.id    = id_;
+      cmd.cmd_type = type_;
+
+      return commands.push(cmd);
+    }
+
+    //*******************************************
+    /// Applies the posted commands.
+    /// Only the commands that were in the queue when it was called are
+    /// applied, so producers cannot hold up the tick.
+    //*******************************************
+    void process_commands()
+    {
+      private_callback_timer_deferred::command cmd;
+
+      uint32_t remaining = commands.capacity();
+
+      while ((remaining-- != 0U) && commands.pop(cmd))
+      {
+        switch (cmd.cmd_type)
+        {
+          case private_callback_timer_deferred::command::START:
+          {
+            timers.start(cmd.id, etl::timer::start::DELAYED);
+            break;
+          }
+
+          case private_callback_timer_deferred::command::START_IMMEDIATE:
+          {
+            timers.start(cmd.id, etl::timer::start::IMMEDIATE);
+            break;
+          }
+
+          case private_callback_timer_deferred::command::STOP:
+          {
+            timers.stop(cmd.id);
+            break;
+          }
+
+          case private_callback_timer_deferred::command::SET_PERIOD:
+          {
+            timers.set_period(cmd.id, cmd.value);
+            break;
+          }
+
+          case private_callback_timer_deferred::command::SET_MODE:
+          {
+            timers.set_mode(cmd.id, cmd.value != 0U);
+            break;
+          }
+
+          default:
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    // The timers, only accessed from the tick thread.
+    etl::icallback_timer_wheel& timers;
+
+    // The commands posted from other threads.
+    private_callback_timer_deferred::command_ring commands;
+  };
+
+  //***************************************************************************
+  /// The deferred callback timer.
+  ///\tparam MAX_TIMERS_         The maximum number of timers.
+  ///\tparam COMMAND_QUEUE_SIZE_ The number of commands that may be pending. Must be a power of 2.
+  //***************************************************************************
+  template <const uint_least16_t MAX_TIMERS_, const uint32_t COMMAND_QUEUE_SIZE_>
+  class callback_timer_deferred : public etl::icallback_timer_deferred
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<COMMAND_QUEUE_SIZE_>::value, "The command queue size must be a power of 2");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_deferred()
+      : icallback_timer_deferred(wheel_timer, cells, COMMAND_QUEUE_SIZE_)
+    {
+      this->initialise_commands();
+    }
+
+  private:
+
+    etl::callback_timer_wheel<MAX_TIMERS_> wheel_timer;
+    private_callback_timer_deferred::cell  cells[COMMAND_QUEUE_SIZE_];
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,568 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "atomic.h"
+#include "placement_new.h"
+#include "private/timer_wheel.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include "delegate.h"
+#endif
+
+#if defined(ETL_IN_UNIT_TEST) && ETL_NOT_USING_STL
+  #define ETL_DISABLE_TIMER_UPDATES
+  #define ETL_ENABLE_TIMER_UPDATES
+  #define ETL_TIMER_UPDATES_ENABLED true
+
+  #undef ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    #define ETL_DISABLE_TIMER_UPDATES (++process_semaphore)
+    #define ETL_ENABLE_TIMER_UPDATES  (--process_semaphore)
+    #define ETL_TIMER_UPDATES_ENABLED (process_semaphore.load() == 0)
+  #endif
+#endif
+
+#if defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+  #if !defined(ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+    #error ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS and/or ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS not defined
+  #endif
+
+  #define ETL_DISABLE_TIMER_UPDATES ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS
+  #define ETL_ENABLE_TIMER_UPDATES  ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS
+  #define ETL_TIMER_UPDATES_ENABLED true
+#endif
+
+namespace etl
+{
+  //*************************************************************************
+  /// The configuration of a timing wheel timer.
+  struct callback_timer_wheel_data
+  {
+    enum callback_type
+    {
+      C_CALLBACK,
+      IFUNCTION,
+      DELEGATE
+    };
+
+    //*******************************************
+    callback_timer_wheel_data()
+      : p_callback(ETL_NULLPTR),
+        period(0),
+        expiry(0),
+        id(etl::timer_wheel::id::NO_TIMER),
+        previous(etl::timer_wheel::id::NO_TIMER),
+        next(etl::timer_wheel::id::NO_TIMER),
+        slot(private_timer_wheel::wheel<callback_timer_wheel_data>::NO_SLOT),
+        repeating(true),
+        cbk_type(IFUNCTION)
+    {
+    }
+
+    //*******************************************
+    /// C function callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer_wheel::id::type id_,
+                              void                       (*p_callback_)(),
+                              uint32_t                   period_,
+                              bool                       repeating_)
+      : p_callback(reinterpret_cast<void*>(p_callback_)),
+        period(period_),
+        expiry(0),
+        id(id_),
+        previous(etl::timer_wheel::id::NO_TIMER),
+        next(etl::timer_wheel::id::NO_TIMER),
+        slot(private_timer_wheel::wheel<callback_timer_wheel_data>::NO_SLOT),
+        repeating(repeating_),
+        cbk_type(C_CALLBACK)
+    {
+    }
+
+    //*******************************************
+    /// ETL function callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer_wheel::id::type id_,
+                              etl::ifunction<void>&      callback_,
+                              uint32_t                   period_,
+                              bool                       repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        expiry(0),
+        id(id_),
+        previous(etl::timer_wheel::id::NO_TIMER),
+        next(etl::timer_wheel::id::NO_TIMER),
+        slot(private_timer_wheel::wheel<callback_timer_wheel_data>::NO_SLOT),
+        repeating(repeating_),
+        cbk_type(IFUNCTION)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*******************************************
+    /// ETL delegate callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer_wheel::id::type id_,
+                              etl::delegate<void()>&     callback_,
+                              uint32_t                   period_,
+                              bool                       repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        expiry(0),
+        id(id_),
+        previous(etl::timer_wheel::id::NO_TIMER),
+        next(etl::timer_wheel::id::NO_TIMER),
+        slot(private_timer_wheel::wheel<callback_timer_wheel_data>::NO_SLOT),
+        repeating(repeating_),
+        cbk_type(DELEGATE)
+    {
+    }
+#endif
+
+    //*******************************************
+    /// Returns true if the timer is active.
+    //*******************************************
+    bool is_active() const
+    {
+      return slot != private_timer_wheel::wheel<callback_timer_wheel_data>::NO_SLOT;
+    }
+
+    void*                      p_callback;
+    uint32_t                   period;
+    uint32_t                   expiry;
+    etl::timer_wheel::id::type id;
+    etl::timer_wheel::id::type previous;
+    etl::timer_wheel::id::type next;
+    uint_least16_t             slot;
+    bool                       repeating;
+    callback_type              cbk_type;
+
+  private:
+
+    // Disabled.
+    callback_timer_wheel_data(const callback_timer_wheel_data& other);
+    callback_timer_wheel_data& operator =(const callback_timer_wheel_data& other);
+  };
+
+  //***************************************************************************
+  /// Interface for the timing wheel callback timer.
+  /// Has the same interface as icallback_timer, but with 16 bit timer ids.
+  /// Registering, starting and stopping a timer is O(1), whatever the number
+  /// of active timers.
+  //***************************************************************************
+  class icallback_timer_wheel
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer_wheel::id::type register_timer(void     (*p_callback_)(),
+                                              uint32_t period_,
+                                              bool     repeating_)
+    {
+      etl::timer_wheel::id::type id = allocate();
+
+      if (id != etl::timer_wheel::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&timer_array[id]) callback_timer_wheel_data(id, p_callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer_wheel::id::type register_timer(etl::ifunction<void>& callback_,
+                                              uint32_t              period_,
+                                              bool                  repeating_)
+    {
+      etl::timer_wheel::id::type id = allocate();
+
+      if (id != etl::timer_wheel::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&timer_array[id]) callback_timer_wheel_data(id, callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer_wheel::id::type register_timer(etl::delegate<void()>& callback_,
+                                              uint32_t               period_,
+                                              bool                   repeating_)
+    {
+      etl::timer_wheel::id::type id = allocate();
+
+      if (id != etl::timer_wheel::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&timer_array[id]) callback_timer_wheel_data(id, callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+#endif
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer_wheel::id::type id_)
+    {
+      bool result = false;
+
+      if (is_valid(id_))
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer_wheel::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_timers.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place and return to the free list.
+          ::new (&timer) callback_timer_wheel_data();
+          timer.next = free_head;
+          free_head  = id_;
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      active_timers.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      initialise_free_list();
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          callback_caller caller;
+          active_timers.advance(count, caller);
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer_wheel::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid(id_))
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer_wheel::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::INACTIVE)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              active_timers.remove(timer.id);
+            }
+
+            active_timers.insert(timer.id, immediate_ ? 0 : timer.period);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer_wheel::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid(id_))
+      {
+        etl::callback_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer_wheel::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_timers.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer_wheel::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer_wheel::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(callback_timer_wheel_data* const timer_array_, const uint_least16_t MAX_TIMERS_)
+      : timer_array(timer_array_),
+        active_timers(timer_array_),
+        enabled(false),
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+        free_head(etl::timer_wheel::id::NO_TIMER),
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+    //*******************************************
+    /// Resets all of the timers and links them into the free list.
+    /// Called by the derived class, once the timer array is constructed.
+    //*******************************************
+    void initialise_free_list()
+    {
+      for (uint_least16_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) callback_timer_wheel_data();
+        timer_array[i].next = ((i + 1U) < MAX_TIMERS) ? etl::timer_wheel::id::type(i + 1U) : etl::timer_wheel::id::type(etl::timer_wheel::id::NO_TIMER);
+      }
+
+      free_head         = (MAX_TIMERS != 0U) ? 0U : etl::timer_wheel::id::type(etl::timer_wheel::id::NO_TIMER);
+      registered_timers = 0U;
+    }
+
+  private:
+
+    //*******************************************
+    /// Calls the callback of an expired timer.
+    //*******************************************
+    struct callback_caller
+    {
+      void operator()(etl::callback_timer_wheel_data& timer)
+      {
+        if (timer.p_callback != ETL_NULLPTR)
+        {
+          if (timer.cbk_type == callback_timer_wheel_data::C_CALLBACK)
+          {
+            // Call the C callback.
+            reinterpret_cast<void(*)()>(timer.p_callback)();
+          }
+          else if (timer.cbk_type == callback_timer_wheel_data::IFUNCTION)
+          {
+            // Call the function wrapper callback.
+            (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+          }
+#if ETL_CPP11_SUPPORTED
+          else if (timer.cbk_type == callback_timer_wheel_data::DELEGATE)
+          {
+            // Call the delegate callback.
+            (*reinterpret_cast<etl::delegate<void()>*>(timer.p_callback))();
+          }
+#endif
+        }
+      }
+    };
+
+    //*******************************************
+    /// Takes a timer from the free list.
+    //*******************************************
+    etl::timer_wheel::id::type allocate()
+    {
+      etl::timer_wheel::id::type id = free_head;
+
+      if (id != etl::timer_wheel::id::NO_TIMER)
+      {
+        free_head = timer_array[id].next;
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    bool is_valid(etl::timer_wheel::id::type id_) const
+    {
+      return id_ < MAX_TIMERS;
+    }
+
+    // The array of timer data structures.
+    callback_timer_wheel_data* const timer_array;
+
+    // The wheel of active timers.
+    private_timer_wheel::wheel<callback_timer_wheel_data> active_timers;
+
+    volatile bool enabled;
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    volatile etl::timer_semaphore_t process_semaphore;
+#endif
+    volatile uint_least16_t registered_timers;
+
+    etl::timer_wheel::id::type free_head;
+
+  public:
+
+    const uint_least16_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The timing wheel callback timer.
+  //***************************************************************************
+  template <const uint_least16_t MAX_TIMERS_>
+  class callback_timer_wheel : public etl::icallback_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 65534U, "No more than 65534 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel(timer_array, MAX_TIMERS_)
+    {
+      this->initialise_free_list();
+    }
+
+  private:
+
+    callback_timer_wheel_data timer_array[MAX_TIMERS_];
+  };
+}
+
+#undef ETL_DISABLE_TIMER_UPDATES
+#undef ETL_ENABLE_TIMER_UPDATES
+#undef ETL_TIMER_UPDATES_ENABLED
+
+#endif
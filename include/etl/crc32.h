@@ -73,6 +73,7 @@ namespace etl
   typedef etl::crc32_t<256U> crc32_t256;
   typedef etl::crc32_t<16U>  crc32_t16;
   typedef etl::crc32_t<4U>   crc32_t4;
+  typedef etl::crc32_t<etl::crc_accelerated> crc32_accelerated;
   typedef crc32_t256         crc32;
 }
 #endif
@@ -73,6 +73,7 @@ namespace etl
   typedef etl::crc32_c_t<256U> crc32_c_t256;
   typedef etl::crc32_c_t<16U>  crc32_c_t16;
   typedef etl::crc32_c_t<4U>   crc32_c_t4;
+  typedef etl::crc32_c_t<etl::crc_accelerated> crc32_c_accelerated;
   typedef crc32_c_t256         crc32_c;
 }
 #endif
@@ -73,6 +73,7 @@ namespace etl
   typedef etl::crc64_ecma_t<256U> crc64_ecma_t256;
   typedef etl::crc64_ecma_t<16U>  crc64_ecma_t16;
   typedef etl::crc64_ecma_t<4U>   crc64_ecma_t4;
+  typedef etl::crc64_ecma_t<etl::crc_accelerated> crc64_ecma_accelerated;
   typedef crc64_ecma_t256         crc64_ecma;
 }
 #endif
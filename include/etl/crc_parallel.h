@@ -0,0 +1,120 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_PARALLEL_INCLUDED
+#define ETL_CRC_PARALLEL_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "private/crc_implementation.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup crc_parallel Multi-threaded CRC calculation
+/// Requires the STL and C++11 for std::thread.
+///\ingroup crc
+
+#if ETL_USING_STL && ETL_CPP11_SUPPORTED
+
+#include <thread>
+#include <vector>
+
+namespace etl
+{
+  //*****************************************************************************
+  /// The smallest block that is given its own thread.
+  //*****************************************************************************
+  static ETL_CONSTANT size_t crc_parallel_minimum_block = 16384U;
+
+  //*****************************************************************************
+  /// Calculates a CRC by splitting the data into blocks, calculating the CRC of
+  /// each block on its own thread and combining the results with crc_combine.
+  /// The calling thread calculates the last block.
+  /// e.g. uint32_t crc = etl::crc_parallel<etl::crc32_c_accelerated>(begin, end, 4U);
+  ///\tparam TCrc The CRC type.
+  ///\param begin     Start of the data.
+  ///\param end       End of the data.
+  ///\param n_threads The maximum number of threads to use, including the caller.
+  //*****************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_parallel(const uint8_t* begin, const uint8_t* end, size_t n_threads)
+  {
+    typedef typename TCrc::value_type value_type;
+
+    const size_t length   = size_t(end - begin);
+    const size_t n_blocks = etl::max(size_t(1U), etl::min(n_threads, length / crc_parallel_minimum_block));
+
+    if (n_blocks == 1U)
+    {
+      return TCrc(begin, end).value();
+    }
+
+    const size_t block_length = length / n_blocks;
+
+    std::vector<value_type>  results(n_blocks);
+    std::vector<std::thread> threads;
+    threads.reserve(n_blocks - 1U);
+
+    for (size_t i = 0U; i < (n_blocks - 1U); ++i)
+    {
+      const uint8_t* block_begin = begin + (i * block_length);
+      value_type*    result      = &results[i];
+
+      threads.emplace_back([block_begin, block_length, result]()
+                           {
+                             *result = TCrc(block_begin, block_begin + block_length).value();
+                           });
+    }
+
+    // The last block takes any remainder.
+    const uint8_t* last_begin  = begin + ((n_blocks - 1U) * block_length);
+    const size_t   last_length = size_t(end - last_begin);
+
+    results[n_blocks - 1U] = TCrc(last_begin, end).value();
+
+    for (size_t i = 0U; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    value_type crc = results[0];
+
+    for (size_t i = 1U; i < n_blocks; ++i)
+    {
+      crc = etl::crc_combine<TCrc>(crc, results[i], (i == (n_blocks - 1U)) ? last_length : block_length);
+    }
+
+    return crc;
+  }
+}
+
+#endif
+#endif
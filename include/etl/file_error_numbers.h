@@ -93,5 +93,8 @@ SOFTWARE.
 #define ETL_MESSAGE_ROUTER_REGISTRY_FILE_ID "60"
 #define ETL_ARRAY_WRAPPER_FILE_ID "61"
 #define ETL_MEM_CAST_FILE_ID "62"
+#define ETL_FLAT_HASH_MAP_FILE_ID "63"
+#define ETL_FLAT_HASH_SET_FILE_ID "64"
+#define ETL_MESSAGE_MAILBOX_FILE_ID "65"
 
 #endif
@@ -0,0 +1,190 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_MEMORY_BLOCK_POOL_ATOMIC_INCLUDED
+#define ETL_FIXED_MEMORY_BLOCK_POOL_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "static_assert.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //*************************************************************************
+  /// A lock-free fixed sized memory block pool.
+  /// The allocated memory blocks are all the same size.
+  /// Blocks may be allocated and released from any number of threads or
+  /// interrupts at once, so a reference_counted_message_pool that uses it
+  /// does not need to override lock() and unlock().
+  /// The free blocks form a Treiber stack. The head holds the index of the
+  /// top block and a tag that changes on every push and pop, so that a
+  /// thread that was pre-empted between reading the head and updating it
+  /// cannot succeed if the stack changed in the meantime (the ABA problem).
+  /// With 64 bit types the index and tag are 32 bits each, otherwise 16 bits.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  class fixed_sized_memory_block_allocator_atomic : public imemory_block_allocator
+  {
+  public:
+
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Alignment  = VAlignment;
+    static ETL_CONSTANT size_t Size       = VSize;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    fixed_sized_memory_block_allocator_atomic()
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        next[i].store(index_type((i + 1U) < Size ? (i + 1U) : Null_Index), etl::memory_order_relaxed);
+      }
+
+      head.store(pack(0U, 0U), etl::memory_order_release);
+    }
+
+#if defined(ETL_IN_UNIT_TEST)
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    /// For unit testing purposes.
+    //*************************************************************************
+    bool is_owner_of(const void* const pblock) const
+    {
+      return (pblock >= static_cast<const void*>(&blocks[0])) && (pblock < static_cast<const void*>(&blocks[Size]));
+    }
+#endif
+
+  private:
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t head_type;
+    typedef uint32_t index_type;
+    static ETL_CONSTANT uint32_t Index_Bits = 32U;
+#else
+    typedef uint32_t head_type;
+    typedef uint16_t index_type;
+    static ETL_CONSTANT uint32_t Index_Bits = 16U;
+#endif
+
+    static ETL_CONSTANT index_type Null_Index = index_type(~index_type(0U));
+
+    ETL_STATIC_ASSERT(VSize > 0U, "Size must be greater than zero");
+    ETL_STATIC_ASSERT(VSize < size_t(index_type(~index_type(0U))), "Size is too large for the index type");
+
+    /// A block of Block_Size bytes and Alignment alignment.
+    typedef typename etl::aligned_storage<Block_Size, Alignment>::type block;
+
+    //*************************************************************************
+    static head_type pack(index_type index, head_type tag)
+    {
+      return (tag << Index_Bits) | head_type(index);
+    }
+
+    //*************************************************************************
+    static index_type index_of(head_type value)
+    {
+      return index_type(value);
+    }
+
+    //*************************************************************************
+    static head_type tag_of(head_type value)
+    {
+      return value >> Index_Bits;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment > Alignment) || (required_size > Block_Size))
+      {
+        return ETL_NULLPTR;
+      }
+
+      head_type current = head.load(etl::memory_order_acquire);
+
+      while (index_of(current) != Null_Index)
+      {
+        const index_type index = index_of(current);
+        const head_type  desired = pack(next[index].load(etl::memory_order_relaxed), tag_of(current) + 1U);
+
+        if (head.compare_exchange_weak(current, desired, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          return &blocks[index];
+        }
+      }
+
+      // None free.
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      const char* const p     = static_cast<const char*>(pblock);
+      const char* const first = reinterpret_cast<const char*>(&blocks[0]);
+      const char* const last  = reinterpret_cast<const char*>(&blocks[Size]);
+
+      if ((p < first) || (p >= last) || ((size_t(p - first) % sizeof(block)) != 0U))
+      {
+        return false;
+      }
+
+      const index_type index = index_type(size_t(p - first) / sizeof(block));
+
+      head_type current = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        next[index].store(index_of(current), etl::memory_order_relaxed);
+      } while (!head.compare_exchange_weak(current, pack(index, tag_of(current) + 1U), etl::memory_order_release, etl::memory_order_relaxed));
+
+      return true;
+    }
+
+    etl::atomic<head_type>  head;
+    etl::atomic<index_type> next[Size];
+    block                   blocks[Size];
+  };
+}
+
+#endif
+#endif
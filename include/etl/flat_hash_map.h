@@ -0,0 +1,892 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_MAP_INCLUDED
+#define ETL_FLAT_HASH_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "alignment.h"
+
+#define ETL_IN_FLAT_HASH_MAP_H
+#include "private/flat_hash_table.h"
+#undef ETL_IN_FLAT_HASH_MAP_H
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup flat_hash_map flat_hash_map
+/// An open addressing hash map with the capacity defined at compile time.
+/// Keys and values are stored inline in a fixed array of slots, with a
+/// separate array of metadata holding each slot's probe distance and hash tag.
+/// Uses Robin Hood linear probing, comparing the metadata of a group of slots
+/// at a time, and backward shift deletion.
+/// Inserting may move elements, so invalidates iterators, pointers and references.
+/// Erasing invalidates iterators, pointers and references to the following elements.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_exception : public etl::exception
+  {
+  public:
+
+    flat_hash_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_full : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:full", ETL_FLAT_HASH_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_out_of_range : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:range", ETL_FLAT_HASH_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_iterator : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:iterator", ETL_FLAT_HASH_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Gets the key from a key/value pair.
+    //*************************************************************************
+    template <typename TPair>
+    struct pair_key
+    {
+      const typename TPair::first_type& operator()(const TPair& p) const
+      {
+        return p.first;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_hash_map.
+  /// Can be used as a reference type for all flat_hash_map containing a specific type.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iflat_hash_map : public etl::private_flat_hash::table<ETL_OR_STD::pair<const TKey, T>,
+                                                             TKey,
+                                                             etl::private_flat_hash::pair_key<ETL_OR_STD::pair<const TKey, T> >,
+                                                             THash,
+                                                             TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_flat_hash::table<ETL_OR_STD::pair<const TKey, T>,
+                                          TKey,
+                                          etl::private_flat_hash::pair_key<ETL_OR_STD::pair<const TKey, T> >,
+                                          THash,
+                                          TKeyEqual> table_t;
+
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    typedef etl::private_flat_hash::flat_hash_iterator<value_type, value_type>       iterator;
+    typedef etl::private_flat_hash::flat_hash_iterator<value_type, const value_type> const_iterator;
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the flat_hash_map.
+    ///\return An iterator to the beginning of the flat_hash_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return make_iterator(this->first_index());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_hash_map.
+    ///\return A const iterator to the beginning of the flat_hash_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return make_iterator(this->first_index());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_hash_map.
+    ///\return A const iterator to the beginning of the flat_hash_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return make_iterator(this->first_index());
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the flat_hash_map.
+    ///\return An iterator to the end of the flat_hash_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return make_iterator(this->number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_hash_map.
+    ///\return A const iterator to the end of the flat_hash_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return make_iterator(this->number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_hash_map.
+    ///\return A const iterator to the end of the flat_hash_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return make_iterator(this->number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of the slots the container can hold.
+    ///\return The maximum number of the slots the container can hold.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return this->number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the number of the slots the container holds.
+    ///\return The number of the slots the container holds.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return this->number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_full if the key does not exist and there is no room.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      size_t index;
+      typename table_t::reserve_status status = this->reserve_index(key, index);
+
+      if (status == table_t::Reserved)
+      {
+        ::new (this->pslots + index) value_type(key, T());
+      }
+      else if (status == table_t::Full)
+      {
+        ETL_ASSERT(false, ETL_ERROR(flat_hash_map_full));
+        return begin()->second;
+      }
+
+      return this->pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      size_t index = this->find_index(key);
+
+      ETL_ASSERT(index != this->number_of_slots, ETL_ERROR(flat_hash_map_out_of_range));
+
+      return this->pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      size_t index = this->find_index(key);
+
+      ETL_ASSERT(index != this->number_of_slots, ETL_ERROR(flat_hash_map_out_of_range));
+
+      return this->pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_hash_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(flat_hash_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      size_t index;
+      typename table_t::reserve_status status = this->reserve_index(key_value_pair.first, index);
+
+      if (status == table_t::Full)
+      {
+        ETL_ASSERT(false, ETL_ERROR(flat_hash_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (status == table_t::Reserved)
+      {
+        ::new (this->pslots + index) value_type(key_value_pair);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), status == table_t::Reserved);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      size_t index;
+      typename table_t::reserve_status status = this->reserve_index(key_value_pair.first, index);
+
+      if (status == table_t::Full)
+      {
+        ETL_ASSERT(false, ETL_ERROR(flat_hash_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (status == table_t::Reserved)
+      {
+        ::new (this->pslots + index) value_type(etl::move(key_value_pair));
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), status == table_t::Reserved);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      size_t index = this->find_index(key);
+
+      if (index == this->number_of_slots)
+      {
+        return 0U;
+      }
+
+      this->erase_index(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    /// The following element may be moved into the erased slot.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the element that followed the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      size_t index = this->index_of(ielement.get_slot());
+
+      this->erase_index(index);
+
+      return make_iterator(this->next_occupied_index(index));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == cbegin()) && (last_ == cend()))
+      {
+        clear();
+        return end();
+      }
+
+      // Erase from the back of the range, as erasing only shifts the elements that follow.
+      size_t first_index = this->index_of(first_.get_slot());
+      size_t index       = this->index_of(last_.get_slot());
+
+      while (index != first_index)
+      {
+        --index;
+
+        if (this->pmetadata[index].distance != 0U)
+        {
+          this->erase_index(index);
+        }
+      }
+
+      return make_iterator(this->next_occupied_index(first_index));
+    }
+
+    //*************************************************************************
+    /// Clears the flat_hash_map.
+    //*************************************************************************
+    void clear()
+    {
+      this->clear_all();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (this->find_index(key) == this->number_of_slots) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return make_iterator(this->find_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return make_iterator(this->find_index(key));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the flat_hash_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return table_t::size();
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_hash_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return table_t::max_size();
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_hash_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return table_t::max_size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_hash_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return table_t::empty();
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_hash_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return table_t::full();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_hash_map& operator = (const iflat_hash_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_hash_map& operator = (iflat_hash_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_hash_map(value_type* pslots_, etl::private_flat_hash::slot_metadata* pmetadata_, size_t number_of_slots_, size_t shift_, size_t max_size_)
+      : table_t(pslots_, pmetadata_, number_of_slots_, shift_, max_size_)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        insert(etl::move(*first++));
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Makes an iterator from a slot index.
+    //*********************************************************************
+    iterator make_iterator(size_t index) const
+    {
+      return iterator(this->pmetadata + index, this->pslots + index);
+    }
+
+    // Disable copy construction.
+    iflat_hash_map(const iflat_hash_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_HASH_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_hash_map()
+    {
+    }
+#else
+  protected:
+    ~iflat_hash_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_hash_map.
+  ///\param rhs Reference to the second flat_hash_map.
+  ///\return <b>true</b> if the maps contain the same key/value pairs, otherwise <b>false</b>
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typename etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>::const_iterator itr = lhs.begin();
+
+    while (itr != lhs.end())
+    {
+      typename etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>::const_iterator other = rhs.find(itr->first);
+
+      if ((other == rhs.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+
+      ++itr;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_hash_map.
+  ///\param rhs Reference to the second flat_hash_map.
+  ///\return <b>true</b> if the maps do not contain the same key/value pairs, otherwise <b>false</b>
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_hash_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_hash_map : public etl::iflat_hash_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_hash_map<TKey, TValue, THash, TKeyEqual> base;
+    typedef etl::private_flat_hash::table_size<MAX_SIZE_>       table_size_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = table_size_t::Slots;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_hash_map()
+      : base(reinterpret_cast<typename base::value_type*>(&buffer), metadata, MAX_SLOTS, table_size_t::Shift, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_hash_map(const flat_hash_map& other)
+      : base(reinterpret_cast<typename base::value_type*>(&buffer), metadata, MAX_SLOTS, table_size_t::Shift, MAX_SIZE)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_hash_map(flat_hash_map&& other)
+      : base(reinterpret_cast<typename base::value_type*>(&buffer), metadata, MAX_SLOTS, table_size_t::Shift, MAX_SIZE)
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_hash_map(TIterator first_, TIterator last_)
+      : base(reinterpret_cast<typename base::value_type*>(&buffer), metadata, MAX_SLOTS, table_size_t::Shift, MAX_SIZE)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_hash_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init)
+      : base(reinterpret_cast<typename base::value_type*>(&buffer), metadata, MAX_SLOTS, table_size_t::Shift, MAX_SIZE)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_map()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_map& operator = (const flat_hash_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_hash_map& operator = (flat_hash_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        base::move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The storage for the slots.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * MAX_SLOTS, etl::alignment_of<typename base::value_type>::value>::type buffer;
+
+    /// The slot metadata, plus a sentinel and group padding.
+    etl::private_flat_hash::slot_metadata metadata[table_size_t::Metadata_Size];
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  flat_hash_map(T, Ts...)
+    ->flat_hash_map<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), typename T::first_type>,
+                    typename T::second_type,
+                    1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
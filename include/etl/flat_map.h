@@ -273,11 +273,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -358,18 +354,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The values are appended, sorted and then merged with the existing elements.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key and with no duplicates, to the flat_map.
+    /// The values are appended and then merged with the existing elements.
+    /// Inserting into an empty flat_map is O(N).
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, false);
     }
 
     //*************************************************************************
@@ -647,6 +654,30 @@ namespace etl
       return refmap_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return refmap_t::find(key);
+    }
+
+    //*********************************************************************
+    /// Finds an element, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return refmap_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -657,6 +688,19 @@ namespace etl
       return refmap_t::count(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return refmap_t::count(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -677,6 +721,30 @@ namespace etl
       return refmap_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return refmap_t::lower_bound(key);
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return refmap_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -697,6 +765,30 @@ namespace etl
       return refmap_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return refmap_t::upper_bound(key);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return refmap_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -717,6 +809,30 @@ namespace etl
       return refmap_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return refmap_t::equal_range(key);
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return refmap_t::equal_range(key);
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -832,6 +948,44 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values by appending and merging.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    ///\param is_unsorted <b>true</b> if the values must be sorted before merging.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_unsorted)
+    {
+      while (first != last)
+      {
+        size_t n = size();
+
+        // Append as many as will fit.
+        while ((first != last) && !refmap_t::full())
+        {
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(*first++);
+          ETL_INCREMENT_DEBUG_COUNT
+          refmap_t::append(*pvalue);
+        }
+
+        if (is_unsorted)
+        {
+          refmap_t::sort_appended(n);
+        }
+
+        // Destroy the values with keys that were already present.
+        erase(refmap_t::merge_appended(n), end());
+
+        // Still full? The next value can only be inserted if its key is already present.
+        if ((first != last) && refmap_t::full())
+        {
+          insert(*first++);
+        }
+      }
+    }
+
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
@@ -943,6 +1097,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted by key and has no duplicates.
+    /// Construction is O(N).
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_map(etl::sorted_unique_t, TIterator first, TIterator last)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), first, last);
+    }
+
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
     //*************************************************************************
     /// Construct from initializer_list.
@@ -952,6 +1120,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Construct from initializer_list that is already sorted by key and has no duplicates.
+    //*************************************************************************
+    flat_map(etl::sorted_unique_t, std::initializer_list<typename etl::iflat_map<TKey, TValue, TCompare>::value_type> init)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), init.begin(), init.end());
+    }
 #endif
 
     //*************************************************************************
@@ -211,11 +211,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -296,18 +292,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
+    /// The values are appended, sorted and then merged with the existing elements.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted and with no duplicates, to the flat_set.
+    /// The values are appended and then merged with the existing elements.
+    /// Inserting into an empty flat_set is O(N).
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, false);
     }
 
     //*************************************************************************
@@ -773,6 +780,44 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values by appending and merging.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    ///\param is_unsorted <b>true</b> if the values must be sorted before merging.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_unsorted)
+    {
+      while (first != last)
+      {
+        size_t n = size();
+
+        // Append as many as will fit.
+        while ((first != last) && !refset_t::full())
+        {
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(*first++);
+          ETL_INCREMENT_DEBUG_COUNT
+          refset_t::append(*pvalue);
+        }
+
+        if (is_unsorted)
+        {
+          refset_t::sort_appended(n);
+        }
+
+        // Destroy the values that were already present.
+        erase(refset_t::merge_appended(n), end());
+
+        // Still full? The next value can only be inserted if it is already present.
+        if ((first != last) && refset_t::full())
+        {
+          insert(*first++);
+        }
+      }
+    }
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
@@ -883,6 +928,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and has no duplicates.
+    /// Construction is O(N).
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set(etl::sorted_unique_t, TIterator first, TIterator last)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), first, last);
+    }
+
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
     //*************************************************************************
     /// Construct from initializer_list.
@@ -892,6 +951,15 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Construct from initializer_list that is already sorted and has no duplicates.
+    //*************************************************************************
+    flat_set(etl::sorted_unique_t, std::initializer_list<T> init)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->insert(etl::sorted_unique_t(), init.begin(), init.end());
+    }
 #endif
 
     //*************************************************************************
@@ -0,0 +1,944 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "basic_format_spec.h"
+#include "algorithm.h"
+#include "private/to_string_helper.h"
+
+///\defgroup format format
+/// Formats values with a std::format style format string, which is parsed at
+/// compile time. Requires C++17.
+///\ingroup string
+
+#if ETL_CPP17_SUPPORTED
+
+// The size of the buffer that arguments other than strings are formatted in,
+// when writing to an output iterator.
+#if !defined(ETL_FORMAT_BUFFER_SIZE)
+  #define ETL_FORMAT_BUFFER_SIZE 64
+#endif
+
+//*****************************************************************************
+/// Makes a format string for etl::format and etl::format_to from a literal.
+/// The text becomes part of a unique type, so that it can be parsed at
+/// compile time.
+/// etl::format(text, ETL_FORMAT_STRING("{} = {:#06x}"), name, value);
+//*****************************************************************************
+#define ETL_FORMAT_STRING(text)                                                                \
+  []                                                                                           \
+  {                                                                                            \
+    struct etl_format_string                                                                   \
+    {                                                                                          \
+      static constexpr auto value() { return text; }                                           \
+      static constexpr size_t size() { return (sizeof(text) / sizeof((text)[0])) - 1U; }       \
+    };                                                                                         \
+    return etl_format_string();                                                                \
+  }()
+
+namespace etl
+{
+  namespace private_format
+  {
+    //*************************************************************************
+    /// Errors found when parsing a format string.
+    //*************************************************************************
+    struct error
+    {
+      enum enum_type
+      {
+        None,
+        Unmatched_Open_Brace,
+        Unmatched_Close_Brace,
+        Invalid_Specification,
+        Mixed_Indexing,
+        Unsupported_Alignment,
+        Width_Too_Large,
+        Precision_Too_Large
+      };
+    };
+
+    //*************************************************************************
+    /// The alignment of a replacement field.
+    //*************************************************************************
+    struct alignment
+    {
+      enum enum_type
+      {
+        Default,
+        Left,
+        Right
+      };
+    };
+
+    //*************************************************************************
+    /// A run of literal text or a replacement field in a format string.
+    //*************************************************************************
+    template <typename TChar>
+    struct field
+    {
+      bool   is_argument   = false;
+      size_t position      = 0U;     // The literal text.
+      size_t length        = 0U;
+      size_t index         = 0U;     // The argument.
+      TChar  fill          = TChar(' ');
+      int    align         = alignment::Default;
+      TChar  sign          = TChar('-');
+      bool   alternate     = false;
+      bool   zero_pad      = false;
+      size_t width         = 0U;
+      bool   has_precision = false;
+      size_t precision     = 0U;
+      TChar  type          = TChar(0);
+    };
+
+    //*************************************************************************
+    /// A parsed format string.
+    /// There can be no more fields than characters.
+    //*************************************************************************
+    template <typename TChar, size_t Max_Fields>
+    struct parsed_format
+    {
+      int          status    = error::None;
+      size_t       count     = 0U;
+      size_t       arguments = 0U;
+      field<TChar> fields[Max_Fields];
+    };
+
+    //*************************************************************************
+    constexpr bool is_digit(uint32_t c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    //*************************************************************************
+    /// Parses the decimal number at s[i], leaving 'i' after it.
+    //*************************************************************************
+    template <typename TChar>
+    constexpr size_t parse_number(const TChar* s, size_t n, size_t& i)
+    {
+      size_t value = 0U;
+
+      while ((i < n) && is_digit(uint32_t(s[i])) && (value < 1000U))
+      {
+        value = (value * 10U) + size_t(uint32_t(s[i]) - '0');
+        ++i;
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Parses the format specification after the ':' at s[i], up to the '}'.
+    /// [[fill]align][sign][#][0][width][.precision][type]
+    //*************************************************************************
+    template <typename TChar>
+    constexpr int parse_specification(const TChar* s, size_t n, size_t& i, field<TChar>& f)
+    {
+      const auto is_align = [](uint32_t c) { return (c == '<') || (c == '>') || (c == '^'); };
+
+      if (((i + 1U) < n) && is_align(uint32_t(s[i + 1U])) && (s[i] != TChar('{')) && (s[i] != TChar('}')))
+      {
+        f.fill = s[i];
+        ++i;
+      }
+
+      if ((i < n) && is_align(uint32_t(s[i])))
+      {
+        if (s[i] == TChar('^'))
+        {
+          return error::Unsupported_Alignment;
+        }
+
+        f.align = (s[i] == TChar('<')) ? alignment::Left : alignment::Right;
+        ++i;
+      }
+
+      if ((i < n) && ((s[i] == TChar('+')) || (s[i] == TChar('-')) || (s[i] == TChar(' '))))
+      {
+        f.sign = s[i];
+        ++i;
+      }
+
+      if ((i < n) && (s[i] == TChar('#')))
+      {
+        f.alternate = true;
+        ++i;
+      }
+
+      if ((i < n) && (s[i] == TChar('0')))
+      {
+        f.zero_pad = true;
+        ++i;
+      }
+
+      f.width = parse_number(s, n, i);
+
+      if (f.width > 255U)
+      {
+        return error::Width_Too_Large;
+      }
+
+      if ((i < n) && (s[i] == TChar('.')))
+      {
+        ++i;
+
+        if ((i == n) || !is_digit(uint32_t(s[i])))
+        {
+          return error::Invalid_Specification;
+        }
+
+        f.has_precision = true;
+        f.precision     = parse_number(s, n, i);
+
+        if (f.precision > 255U)
+        {
+          return error::Precision_Too_Large;
+        }
+      }
+
+      if ((i < n) && (s[i] != TChar('}')))
+      {
+        const char types[] = "bBcdoxXeEfFgGsp";
+
+        for (size_t t = 0U; types[t] != '\0'; ++t)
+        {
+          if (s[i] == TChar(types[t]))
+          {
+            f.type = s[i];
+          }
+        }
+
+        if (f.type == TChar(0))
+        {
+          return error::Invalid_Specification;
+        }
+
+        ++i;
+      }
+
+      return error::None;
+    }
+
+    //*************************************************************************
+    /// Splits a format string into literal text and replacement fields.
+    /// "{{" and "}}" are literal braces.
+    //*************************************************************************
+    template <typename TChar, size_t Max_Fields>
+    constexpr parsed_format<TChar, Max_Fields> parse(const TChar* s, size_t n)
+    {
+      parsed_format<TChar, Max_Fields> result;
+
+      size_t i               = 0U;
+      size_t literal         = 0U;
+      size_t next_index      = 0U;
+      bool   automatic_index = false;
+      bool   manual_index    = false;
+
+      const auto add_literal = [&](size_t last)
+      {
+        if (last != literal)
+        {
+          field<TChar>& f = result.fields[result.count++];
+          f.position = literal;
+          f.length   = last - literal;
+        }
+      };
+
+      while ((i < n) && (result.status == error::None))
+      {
+        const bool is_escape = ((i + 1U) < n) && (s[i + 1U] == s[i]);
+
+        if ((s[i] == TChar('{')) && !is_escape)
+        {
+          add_literal(i);
+          ++i;
+
+          field<TChar> f;
+          f.is_argument = true;
+
+          if ((i < n) && is_digit(uint32_t(s[i])))
+          {
+            f.index = parse_number(s, n, i);
+            manual_index = true;
+          }
+          else
+          {
+            f.index = next_index++;
+            automatic_index = true;
+          }
+
+          if ((i < n) && (s[i] == TChar(':')))
+          {
+            ++i;
+            result.status = parse_specification(s, n, i, f);
+          }
+
+          if (result.status == error::None)
+          {
+            if (i == n)
+            {
+              result.status = error::Unmatched_Open_Brace;
+            }
+            else if (s[i] != TChar('}'))
+            {
+              result.status = error::Invalid_Specification;
+            }
+            else if (automatic_index && manual_index)
+            {
+              result.status = error::Mixed_Indexing;
+            }
+          }
+
+          result.fields[result.count++] = f;
+          result.arguments = ((f.index + 1U) > result.arguments) ? (f.index + 1U) : result.arguments;
+
+          ++i;
+          literal = i;
+        }
+        else if ((s[i] == TChar('{')) || (s[i] == TChar('}')))
+        {
+          if (!is_escape)
+          {
+            result.status = error::Unmatched_Close_Brace;
+          }
+
+          // Keep the first of the pair.
+          add_literal(i + 1U);
+          i += 2U;
+          literal = i;
+        }
+        else
+        {
+          ++i;
+        }
+      }
+
+      add_literal(n);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The parsed form of a format string made with ETL_FORMAT_STRING.
+    //*************************************************************************
+    template <typename TFormat>
+    struct format_string
+    {
+      typedef typename etl::remove_cv<typename etl::remove_pointer<decltype(TFormat::value())>::type>::type char_type;
+
+      static constexpr auto parsed = parse<char_type, TFormat::size() + 1U>(TFormat::value(), TFormat::size());
+
+      static constexpr field<char_type> get(size_t i)
+      {
+        return parsed.fields[i];
+      }
+    };
+
+    //*************************************************************************
+    /// Reports the errors in a format string, and checks the arguments.
+    /// Returns true if the format string may be used.
+    //*************************************************************************
+    template <typename TFormat, size_t N_Arguments>
+    constexpr bool check_format_string()
+    {
+      constexpr int status = format_string<TFormat>::parsed.status;
+
+      static_assert(status != error::Unmatched_Open_Brace,  "etl::format: '{' without a matching '}'");
+      static_assert(status != error::Unmatched_Close_Brace, "etl::format: '}' without a matching '{'");
+      static_assert(status != error::Invalid_Specification, "etl::format: invalid format specification");
+      static_assert(status != error::Mixed_Indexing,        "etl::format: cannot mix automatic and manual argument indexes");
+      static_assert(status != error::Unsupported_Alignment, "etl::format: centre alignment is not supported");
+      static_assert(status != error::Width_Too_Large,       "etl::format: the width must be less than 256");
+      static_assert(status != error::Precision_Too_Large,   "etl::format: the precision must be less than 256");
+      static_assert(format_string<TFormat>::parsed.arguments <= N_Arguments, "etl::format: not enough arguments");
+
+      return (status == error::None) && (format_string<TFormat>::parsed.arguments <= N_Arguments);
+    }
+
+    //*************************************************************************
+    /// The argument at 'Index'.
+    //*************************************************************************
+    template <size_t Index, typename T, typename... TRest>
+    constexpr const auto& get_argument(const T& first, const TRest&... rest)
+    {
+      if constexpr (Index == 0U)
+      {
+        return first;
+      }
+      else
+      {
+        return get_argument<Index - 1U>(rest...);
+      }
+    }
+
+    //*************************************************************************
+    /// Whether T is derived from etl::ibasic_string<TChar>.
+    //*************************************************************************
+    template <typename T, typename TChar, bool Is_Class = etl::is_class<T>::value>
+    struct is_ibasic_string : etl::bool_constant<etl::is_base_of<etl::ibasic_string<TChar>, T>::value>
+    {
+    };
+
+    template <typename T, typename TChar>
+    struct is_ibasic_string<T, TChar, false> : etl::false_type
+    {
+    };
+
+    //*************************************************************************
+    /// The categories of argument.
+    //*************************************************************************
+    struct category
+    {
+      enum enum_type
+      {
+        Boolean,
+        Character,
+        Integral,
+        Floating_Point,
+        String,
+        Pointer,
+        Unsupported
+      };
+    };
+
+    //*************************************************************************
+    template <typename T, typename TChar>
+    constexpr int get_category()
+    {
+      typedef typename etl::decay<T>::type type;
+
+      if constexpr (etl::is_same<type, bool>::value)
+      {
+        return category::Boolean;
+      }
+      else if constexpr (etl::is_same<type, TChar>::value)
+      {
+        return category::Character;
+      }
+      else if constexpr (etl::is_integral<type>::value)
+      {
+        return category::Integral;
+      }
+      else if constexpr (etl::is_floating_point<type>::value)
+      {
+        return category::Floating_Point;
+      }
+      else if constexpr (etl::is_same<type, TChar*>::value ||
+                         etl::is_same<type, const TChar*>::value ||
+                         is_ibasic_string<type, TChar>::value ||
+                         etl::is_same<type, etl::basic_string_view<TChar> >::value)
+      {
+        return category::String;
+      }
+      else if constexpr (etl::is_pointer<type>::value)
+      {
+        return category::Pointer;
+      }
+      else
+      {
+        return category::Unsupported;
+      }
+    }
+
+    //*************************************************************************
+    /// Whether the presentation type may be used with the category.
+    //*************************************************************************
+    template <typename TChar>
+    constexpr bool is_valid_type(int cat, TChar type)
+    {
+      const auto is_any_of = [type](const char* types)
+      {
+        for (size_t i = 0U; types[i] != '\0'; ++i)
+        {
+          if (type == TChar(types[i]))
+          {
+            return true;
+          }
+        }
+
+        return false;
+      };
+
+      switch (cat)
+      {
+        case category::Boolean:        return is_any_of("sbBdoxX");
+        case category::Character:      return is_any_of("cbBdoxX");
+        case category::Integral:       return is_any_of("cbBdoxX");
+        case category::Floating_Point: return is_any_of("eEfFgG");
+        case category::String:         return is_any_of("s");
+        case category::Pointer:        return is_any_of("p");
+        default:                       return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Booleans and characters are shown as text unless given an integer type.
+    //*************************************************************************
+    template <typename TChar>
+    constexpr bool is_text(int cat, TChar type)
+    {
+      return (cat == category::String) ||
+             ((cat == category::Boolean) && ((type == TChar(0)) || (type == TChar('s')))) ||
+             ((cat == category::Character) && ((type == TChar(0)) || (type == TChar('c')))) ||
+             ((cat == category::Integral) && (type == TChar('c')));
+    }
+
+    //*************************************************************************
+    /// The etl::basic_format_spec for a replacement field.
+    /// Widths are applied afterwards, so that they can follow std::format.
+    //*************************************************************************
+    template <typename TIString>
+    constexpr etl::basic_format_spec<TIString> make_format_spec(const field<typename TIString::value_type>& f, int cat)
+    {
+      typedef typename TIString::value_type TChar;
+
+      etl::basic_format_spec<TIString> spec;
+
+      switch (uint32_t(f.type))
+      {
+        case 'b': case 'B': spec.binary();  break;
+        case 'o':           spec.octal();   break;
+        case 'x': case 'X': spec.hex();     break;
+        case 'e': case 'E': spec.scientific(); break;
+        case 'g': case 'G': spec.general(); break;
+        case 0:             spec.general(); break;
+        default:            break;
+      }
+
+      spec.upper_case((f.type == TChar('B')) || (f.type == TChar('X')) || (f.type == TChar('E')) ||
+                      (f.type == TChar('F')) || (f.type == TChar('G')));
+
+      if (cat == category::Pointer)
+      {
+        spec.hex();
+      }
+      else if (f.alternate)
+      {
+        spec.show_base(true);
+      }
+
+      // Fixed and scientific default to 6 digits, as printf.
+      spec.precision(f.has_precision ? f.precision : 6U);
+      spec.boolalpha(true);
+
+      return spec;
+    }
+
+    //*************************************************************************
+    /// Appends an integer. Negative values are shown with a sign in all bases.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    void add_integer(etl::ibasic_string<TChar>& str, T value, const etl::basic_format_spec<etl::ibasic_string<TChar> >& spec)
+    {
+      // long long may not be the same type as int64_t.
+      typedef typename etl::conditional<(sizeof(T) > sizeof(int32_t)), uint64_t, uint32_t>::type unsigned_type;
+      typedef typename etl::conditional<(sizeof(T) > sizeof(int32_t)), int64_t,  int32_t>::type  signed_type;
+
+      if constexpr (etl::is_signed<T>::value)
+      {
+        if ((value < 0) && (spec.get_base() != 10U))
+        {
+          str.push_back(TChar('-'));
+          etl::private_to_string::to_string(unsigned_type(0U - unsigned_type(value)), str, spec, true);
+        }
+        else
+        {
+          etl::private_to_string::to_string(signed_type(value), str, spec, true);
+        }
+      }
+      else
+      {
+        etl::private_to_string::to_string(unsigned_type(value), str, spec, true);
+      }
+    }
+
+    //*************************************************************************
+    /// Appends a floating point value. Unlike to_string, negative zero,
+    /// infinity and NaN keep their sign, and the upper case types show "INF"
+    /// and "NAN".
+    //*************************************************************************
+    template <typename TChar, typename T>
+    void add_floating_point(etl::ibasic_string<TChar>& str, T value, const etl::basic_format_spec<etl::ibasic_string<TChar> >& spec)
+    {
+      if (isnan(value) || isinf(value))
+      {
+        if (signbit(value))
+        {
+          str.push_back(TChar('-'));
+        }
+
+        const char* text = isnan(value) ? (spec.is_upper_case() ? "NAN" : "nan") : (spec.is_upper_case() ? "INF" : "inf");
+
+        while (*text != '\0')
+        {
+          str.push_back(TChar(*text++));
+        }
+      }
+      else
+      {
+        if (signbit(value) && (value == T(0)))
+        {
+          str.push_back(TChar('-'));
+        }
+
+        etl::private_to_string::to_string(value, str, spec, true);
+      }
+    }
+
+    //*************************************************************************
+    /// Is the value an infinity or NaN, which are not padded with zeros?
+    //*************************************************************************
+    template <typename T>
+    bool is_nan_or_inf(const T& value)
+    {
+      if constexpr (etl::is_floating_point<T>::value)
+      {
+        return isnan(value) || isinf(value);
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Appends an argument, without the width, and returns the number of
+    /// characters of sign and base prefix that zero padding goes after.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    size_t add_value(etl::ibasic_string<TChar>& str, const T& value, const field<TChar>& f, const etl::basic_format_spec<etl::ibasic_string<TChar> >& spec)
+    {
+      constexpr int cat = get_category<T, TChar>();
+
+      if constexpr (cat == category::String)
+      {
+        const etl::basic_string_view<TChar> view(value);
+
+        str.append(view.data(), (f.has_precision && (f.precision < view.size())) ? f.precision : view.size());
+
+        return 0U;
+      }
+      else if constexpr (cat == category::Pointer)
+      {
+        // The "0x" is added here, so that a null pointer is "0x0".
+        str.push_back(TChar('0'));
+        str.push_back(TChar('x'));
+        etl::private_to_string::to_string(static_cast<const volatile void*>(value), str, spec, true);
+
+        return 2U;
+      }
+      else
+      {
+        if (is_text(cat, f.type))
+        {
+          if constexpr (cat == category::Boolean)
+          {
+            etl::private_to_string::to_string(value, str, spec, true);
+          }
+          else
+          {
+            str.push_back(TChar(value));
+          }
+
+          return 0U;
+        }
+
+        const size_t start = str.size();
+
+        if constexpr (cat == category::Boolean)
+        {
+          etl::private_to_string::to_string(uint32_t(value ? 1U : 0U), str, spec, true);
+        }
+        else if constexpr (cat == category::Floating_Point)
+        {
+          add_floating_point(str, value, spec);
+        }
+        else
+        {
+          add_integer(str, value, spec);
+        }
+
+        const bool has_base_prefix = f.alternate && ((spec.get_base() == 2U) || (spec.get_base() == 16U));
+
+        // to_string shows zero without the base prefix.
+        if (has_base_prefix && (str.size() == (start + 1U)) && (str[start] == TChar('0')))
+        {
+          const TChar base = (spec.get_base() == 2U) ? TChar('b') : TChar('x');
+
+          str.insert(str.begin() + start, 1U, TChar('0'));
+          str.insert(str.begin() + start + 1U, 1U, spec.is_upper_case() ? TChar(base - TChar('a') + TChar('A')) : base);
+        }
+
+        size_t prefix = 0U;
+
+        if ((str.size() != start) && (str[start] == TChar('-')))
+        {
+          prefix = 1U;
+        }
+        else if (f.sign != TChar('-'))
+        {
+          str.insert(str.begin() + start, f.sign);
+          prefix = 1U;
+        }
+
+        if (has_base_prefix)
+        {
+          prefix += 2U;
+        }
+
+        return prefix;
+      }
+    }
+
+    //*************************************************************************
+    /// Appends an argument with its replacement field's format.
+    //*************************************************************************
+    template <typename TFormat, size_t Index, typename TChar, typename T>
+    void add_argument(etl::ibasic_string<TChar>& str, const T& value)
+    {
+      constexpr field<TChar> f   = format_string<TFormat>::get(Index);
+      constexpr int          cat = get_category<T, TChar>();
+
+      static_assert(cat != category::Unsupported, "etl::format: the argument type cannot be formatted");
+      static_assert((f.type == TChar(0)) || is_valid_type(cat, f.type), "etl::format: the format type is not valid for the argument");
+      static_assert((f.sign == TChar('-')) || ((cat != category::Pointer) && !is_text(cat, f.type)), "etl::format: a sign may only be used with numbers");
+      static_assert(!f.has_precision || (cat == category::String) || ((cat == category::Floating_Point) && (f.type != TChar(0)) && (f.type != TChar('g')) && (f.type != TChar('G'))),
+                    "etl::format: a precision may only be used with strings and fixed or scientific floating point");
+
+      constexpr etl::basic_format_spec<etl::ibasic_string<TChar> > spec = make_format_spec<etl::ibasic_string<TChar> >(f, cat);
+
+      const size_t start  = str.size();
+      const size_t prefix = add_value(str, value, f, spec);
+      const size_t length = str.size() - start;
+
+      if (length < f.width)
+      {
+        const size_t padding = f.width - length;
+
+        if (f.zero_pad && (f.align == alignment::Default) && !is_text(cat, f.type) && !is_nan_or_inf(value))
+        {
+          str.insert(str.begin() + start + prefix, padding, TChar('0'));
+        }
+        else if ((f.align == alignment::Left) || ((f.align == alignment::Default) && is_text(cat, f.type)))
+        {
+          str.append(padding, f.fill);
+        }
+        else
+        {
+          str.insert(str.begin() + start, padding, f.fill);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Appends literal text or an argument.
+    //*************************************************************************
+    template <typename TFormat, size_t Index, typename TChar, typename... TArgs>
+    void add_field(etl::ibasic_string<TChar>& str, const TArgs&... args)
+    {
+      constexpr field<TChar> f = format_string<TFormat>::get(Index);
+
+      if constexpr (f.is_argument)
+      {
+        add_argument<TFormat, Index>(str, get_argument<f.index>(args...));
+      }
+      else
+      {
+        str.append(TFormat::value() + f.position, f.length);
+      }
+    }
+
+    //*************************************************************************
+    template <typename TFormat, typename TChar, size_t... Indexes, typename... TArgs>
+    void add_fields(etl::ibasic_string<TChar>& str, etl::index_sequence<Indexes...>, const TArgs&... args)
+    {
+      (add_field<TFormat, Indexes>(str, args...), ...);
+    }
+
+    //*************************************************************************
+    /// A string of any character type, for formatting arguments when writing
+    /// to an output iterator.
+    //*************************************************************************
+    template <typename TChar, size_t Size>
+    class buffer : public etl::ibasic_string<TChar>
+    {
+    public:
+
+      buffer()
+        : etl::ibasic_string<TChar>(characters, Size)
+      {
+        this->initialise();
+      }
+
+      void repair()
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+        ETL_OVERRIDE
+#endif
+      {
+        etl::ibasic_string<TChar>::repair_buffer(characters);
+      }
+
+    private:
+
+      TChar characters[Size + 1U];
+    };
+
+    //*************************************************************************
+    /// Writes literal text or an argument to an output iterator.
+    /// Arguments other than strings are formatted in a buffer first.
+    //*************************************************************************
+    template <typename TFormat, size_t Index, typename TIterator, typename... TArgs>
+    TIterator write_field(TIterator out, const TArgs&... args)
+    {
+      typedef typename format_string<TFormat>::char_type TChar;
+
+      constexpr field<TChar> f = format_string<TFormat>::get(Index);
+
+      if constexpr (!f.is_argument)
+      {
+        const TChar* p = TFormat::value() + f.position;
+
+        return etl::copy(p, p + f.length, out);
+      }
+      else
+      {
+        const auto& value = get_argument<f.index>(args...);
+
+        if constexpr (get_category<decltype(value), TChar>() == category::String)
+        {
+          static_assert((f.type == TChar(0)) || (f.type == TChar('s')), "etl::format: the format type is not valid for the argument");
+          static_assert(f.sign == TChar('-'), "etl::format: a sign may only be used with numbers");
+
+          const etl::basic_string_view<TChar> view(value);
+
+          const size_t length  = (f.has_precision && (f.precision < view.size())) ? f.precision : view.size();
+          const size_t padding = (length < f.width) ? (f.width - length) : 0U;
+
+          if (f.align == alignment::Right)
+          {
+            out = etl::fill_n(out, padding, f.fill);
+          }
+
+          out = etl::copy(view.data(), view.data() + length, out);
+
+          if (f.align != alignment::Right)
+          {
+            out = etl::fill_n(out, padding, f.fill);
+          }
+
+          return out;
+        }
+        else
+        {
+          private_format::buffer<TChar, ETL_FORMAT_BUFFER_SIZE> text;
+
+          add_argument<TFormat, Index>(text, value);
+
+          return etl::copy(text.begin(), text.end(), out);
+        }
+      }
+    }
+
+    //*************************************************************************
+    template <typename TFormat, typename TIterator, size_t... Indexes, typename... TArgs>
+    TIterator write_fields(TIterator out, etl::index_sequence<Indexes...>, const TArgs&... args)
+    {
+      ((out = write_field<TFormat, Indexes>(out, args...)), ...);
+
+      return out;
+    }
+  }
+
+  //***************************************************************************
+  /// Appends the arguments to a string, formatted with a format string made
+  /// by ETL_FORMAT_STRING.
+  /// Replacement fields are {[index][:[[fill]align][sign][#][0][width][.precision][type]]}
+  /// as std::format, except that there is no centre alignment or dynamic
+  /// width and precision, and general notation 'g' has no precision and is
+  /// the shortest representation. Floating point values are rounded as by
+  /// etl::to_string, so exact ties round away from zero.
+  /// The format string is checked, and split into literal text and
+  /// arguments, at compile time.
+  //***************************************************************************
+  template <typename TChar, typename TFormat, typename... TArgs>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, TFormat, const TArgs&... args)
+  {
+    static_assert(etl::is_same<TChar, typename private_format::format_string<TFormat>::char_type>::value, "etl::format: the format string must have the same character type as the string");
+
+    if constexpr (private_format::check_format_string<TFormat, sizeof...(TArgs)>())
+    {
+      private_format::add_fields<TFormat>(str, etl::make_index_sequence<private_format::format_string<TFormat>::parsed.count>(), args...);
+    }
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Writes the arguments to an output iterator, formatted with a format
+  /// string made by ETL_FORMAT_STRING.
+  /// Arguments other than strings must fit in ETL_FORMAT_BUFFER_SIZE characters.
+  /// Returns the iterator after the last character written.
+  //***************************************************************************
+  template <typename TIterator, typename TFormat, typename... TArgs>
+  typename etl::enable_if<!private_format::is_ibasic_string<TIterator, typename private_format::format_string<TFormat>::char_type>::value, TIterator>::type
+    format_to(TIterator out, TFormat, const TArgs&... args)
+  {
+    if constexpr (private_format::check_format_string<TFormat, sizeof...(TArgs)>())
+    {
+      out = private_format::write_fields<TFormat>(out, etl::make_index_sequence<private_format::format_string<TFormat>::parsed.count>(), args...);
+    }
+
+    return out;
+  }
+
+  //***************************************************************************
+  /// Replaces the contents of a string with the arguments, formatted with a
+  /// format string made by ETL_FORMAT_STRING.
+  //***************************************************************************
+  template <typename TChar, typename TFormat, typename... TArgs>
+  etl::ibasic_string<TChar>& format(etl::ibasic_string<TChar>& str, TFormat text, const TArgs&... args)
+  {
+    str.clear();
+
+    return etl::format_to(str, text, args...);
+  }
+}
+
+#endif
+#endif
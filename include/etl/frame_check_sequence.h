@@ -35,6 +35,7 @@ SOFTWARE.
 #include "binary.h"
 
 #include "iterator.h"
+#include "private/is_contiguous_iterator.h"
 
 ETL_STATIC_ASSERT(ETL_8BIT_SUPPORT, "This file does not currently support targets with no 8bit type");
 
@@ -89,6 +90,29 @@ namespace etl
 
       TFCS* p_fcs;
     };
+
+    //***************************************************
+    /// Checks whether a policy can add a block of bytes in one call.
+    /// Policies declare this with a 'block_add_supported' typedef.
+    //***************************************************
+    template <typename TPolicy>
+    struct policy_supports_block_add
+    {
+    private:
+
+      typedef char(&yes)[1];
+      typedef char(&no)[2];
+
+      template <typename U>
+      static yes test(typename U::block_add_supported*);
+
+      template <typename U>
+      static no test(...);
+
+    public:
+
+      static ETL_CONSTANT bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
   }
 
   //***************************************************************************
@@ -147,10 +171,10 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin++);
-      }
+      typedef etl::integral_constant<bool, private_frame_check_sequence::policy_supports_block_add<TPolicy>::value &&
+                                           etl::private_iterator::is_contiguous_iterator<TIterator>::value> use_block_add;
+
+      add(begin, end, use_block_add());
     }
 
     //*************************************************************************
@@ -187,6 +211,30 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range as a single block.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end, etl::true_type)
+    {
+      if (begin != end)
+      {
+        frame_check = policy.add(frame_check, reinterpret_cast<const uint8_t*>(&*begin), size_t(end - begin));
+      }
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -118,6 +118,21 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent version, comparing any pair of types.
+  //***************************************************************************
+  template <>
+  struct less<void>
+  {
+    typedef int is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return (lhs < rhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct less_equal
@@ -130,6 +145,21 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent version, comparing any pair of types.
+  //***************************************************************************
+  template <>
+  struct less_equal<void>
+  {
+    typedef int is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return !(rhs < lhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct greater
@@ -142,6 +172,21 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent version, comparing any pair of types.
+  //***************************************************************************
+  template <>
+  struct greater<void>
+  {
+    typedef int is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return (rhs < lhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct greater_equal
@@ -154,6 +199,21 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent version, comparing any pair of types.
+  //***************************************************************************
+  template <>
+  struct greater_equal<void>
+  {
+    typedef int is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return !(lhs < rhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct equal_to
@@ -166,6 +226,21 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent version, comparing any pair of types.
+  //***************************************************************************
+  template <>
+  struct equal_to<void>
+  {
+    typedef int is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return (lhs == rhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct not_equal_to
@@ -178,6 +253,21 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Transparent version, comparing any pair of types.
+  //***************************************************************************
+  template <>
+  struct not_equal_to<void>
+  {
+    typedef int is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return !(lhs == rhs);
+    }
+  };
+
   //***************************************************************************
 
   template <typename TArgumentType, typename TResultType>
@@ -564,31 +564,31 @@ namespace etl
     //********************************************
     etl::fsm_state_id_t process_event(const etl::imessage& message)
     {
-      etl::fsm_state_id_t new_state_id;
+      if constexpr (sizeof...(TMessageTypes) != 0U)
+      {
+        const size_t index = message_id_lookup::find(message.get_message_id());
 
-      const bool was_handled = (process_event_type<TMessageTypes>(message, new_state_id) || ...);
+        if (index != message_id_lookup::npos)
+        {
+          // Jump straight to the handler for the message type.
+          static constexpr handler_t handlers[] = { &fsm_state::template process_event_type<TMessageTypes>... };
 
-      if (!was_handled)
-      {
-        new_state_id = (p_parent != nullptr) ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
+          return handlers[index](*static_cast<TDerived*>(this), message);
+        }
       }
 
-      return new_state_id;
+      return (p_parent != nullptr) ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
     }
 
+    typedef etl::private_message_router::message_id_lookup<TMessageTypes...> message_id_lookup;
+
+    typedef etl::fsm_state_id_t (*handler_t)(TDerived&, const etl::imessage&);
+
     //********************************************
     template <typename TMessage>
-    bool process_event_type(const etl::imessage& msg, etl::fsm_state_id_t& state_id)
+    static etl::fsm_state_id_t process_event_type(TDerived& derived, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        state_id = static_cast<TDerived*>(this)->on_event(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      return derived.on_event(static_cast<const TMessage&>(msg));
     }
   };
 #else
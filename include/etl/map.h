@@ -49,6 +49,8 @@ SOFTWARE.
 #include "utility.h"
 #include "placement_new.h"
 
+#include "private/comparator_is_transparent.h"
+
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
 #endif
@@ -528,6 +530,20 @@ namespace etl
       return kcompare(key, node.value.first);
     }
 
+#if ETL_CPP11_SUPPORTED
+    template <typename K>
+    bool node_comp(const Data_Node& node, const K& key) const
+    {
+      return kcompare(node.value.first, key);
+    }
+
+    template <typename K>
+    bool node_comp(const K& key, const Data_Node& node) const
+    {
+      return kcompare(key, node.value.first);
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used in the map.
@@ -969,6 +985,21 @@ namespace etl
       return find_node(root_node, key) ? 1 : 0;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts the number of elements that contain a key that compares
+    /// equivalent to the value specified.
+    /// Only available if the key compare type is transparent.
+    ///\param key The value to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_type count(const K& key) const
+    {
+      return find_node(root_node, key) ? 1 : 0;
+    }
+#endif
+
     //*************************************************************************
     /// Returns two iterators with bounding (lower bound, upper bound) the key
     /// provided
@@ -991,6 +1022,34 @@ namespace etl
         const_iterator(*this, find_upper_node(root_node, key)));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) a value
+    /// that compares equivalent to the key.
+    /// Only available if the key compare type is transparent.
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair<iterator, iterator>(
+        iterator(*this, find_lower_node(root_node, key)),
+        iterator(*this, find_upper_node(root_node, key)));
+    }
+
+    //*************************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// a value that compares equivalent to the key.
+    /// Only available if the key compare type is transparent.
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(
+        const_iterator(*this, find_lower_node(root_node, key)),
+        const_iterator(*this, find_upper_node(root_node, key)));
+    }
+#endif
+
     //*************************************************************************
     /// Erases the value at the specified position.
     //*************************************************************************
@@ -1072,6 +1131,32 @@ namespace etl
       return const_iterator(*this, find_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element with a key that compares equivalent to the value.
+    /// Only available if the key compare type is transparent.
+    ///\param key The value to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return iterator(*this, find_node(root_node, key));
+    }
+
+    //*********************************************************************
+    /// Finds an element with a key that compares equivalent to the value.
+    /// Only available if the key compare type is transparent.
+    ///\param key The value to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_iterator(*this, find_node(root_node, key));
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a value to the map.
     /// If asserts or exceptions are enabled, emits map_full if the map is already full.
@@ -1278,6 +1363,52 @@ namespace etl
       return const_iterator(*this, find_upper_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the value provided.
+    /// Only available if the key compare type is transparent.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, find_lower_node(root_node, key));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the container
+    /// whose key is not considered to go before the value provided.
+    /// Only available if the key compare type is transparent.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, find_lower_node(root_node, key));
+    }
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is considered to go after the value provided.
+    /// Only available if the key compare type is transparent.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, find_upper_node(root_node, key));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the container
+    /// whose key is considered to go after the value provided.
+    /// Only available if the key compare type is transparent.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, find_upper_node(root_node, key));
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -1433,6 +1564,42 @@ namespace etl
       return found;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the value matching the key provided, for transparent comparators.
+    //*************************************************************************
+    template <typename K>
+    Node* find_node(Node* position, const K& key)
+    {
+      Node* found = position;
+      while (found)
+      {
+        // Downcast found to Data_Node class for comparison and other operations
+        Data_Node& found_data_node = imap::data_cast(*found);
+
+        // Compare the node value to the current position value
+        if (node_comp(key, found_data_node))
+        {
+          // Keep searching for the node on the left
+          found = found->children[kLeft];
+        }
+        else if (node_comp(found_data_node, key))
+        {
+          // Keep searching for the node on the right
+          found = found->children[kRight];
+        }
+        else
+        {
+          // Node that matches the key provided was found, exit loop
+          break;
+        }
+      }
+
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
+#endif
+
     //*************************************************************************
     /// Find the value matching the node provided
     //*************************************************************************
@@ -1466,6 +1633,42 @@ namespace etl
       return found;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the value matching the key provided, for transparent comparators.
+    //*************************************************************************
+    template <typename K>
+    const Node* find_node(const Node* position, const K& key) const
+    {
+      const Node* found = position;
+      while (found)
+      {
+        // Downcast found to Data_Node class for comparison and other operations
+        const Data_Node& found_data_node = imap::data_cast(*found);
+
+        // Compare the node value to the current position value
+        if (node_comp(key, found_data_node))
+        {
+          // Keep searching for the node on the left
+          found = found->children[kLeft];
+        }
+        else if (node_comp(found_data_node, key))
+        {
+          // Keep searching for the node on the right
+          found = found->children[kRight];
+        }
+        else
+        {
+          // Node that matches the key provided was found, exit loop
+          break;
+        }
+      }
+
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
+#endif
+
     //*************************************************************************
     /// Find the reference node matching the node provided
     //*************************************************************************
@@ -1648,6 +1851,50 @@ namespace etl
       return lower_node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the node whose key is not considered to go before the key provided, for transparent comparators.
+    //*************************************************************************
+    template <typename K>
+    Node* find_lower_node(Node* position, const K& key) const
+    {
+      // Something at this position? keep going
+      Node* lower_node = ETL_NULLPTR;
+      while (position)
+      {
+        // Downcast lower node to Data_Node reference for key comparisons
+        Data_Node& data_node = imap::data_cast(*position);
+        // Compare the key value to the current lower node key value
+        if (node_comp(key, data_node))
+        {
+          lower_node = position;
+          if (position->children[kLeft])
+          {
+            position = position->children[kLeft];
+          }
+          else
+          {
+            // Found lowest node
+            break;
+          }
+        }
+        else if (node_comp(data_node, key))
+        {
+          position = position->children[kRight];
+        }
+        else
+        {
+          // Make note of current position, but keep looking to left for more
+          lower_node = position;
+          position = position->children[kLeft];
+        }
+      }
+
+      // Return the lower_node position found
+      return lower_node;
+    }
+#endif
+
     //*************************************************************************
     /// Find the node whose key is considered to go after the key provided
     //*************************************************************************
@@ -1686,6 +1933,47 @@ namespace etl
       return upper_node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the node whose key is considered to go after the key provided, for transparent comparators.
+    //*************************************************************************
+    template <typename K>
+    Node* find_upper_node(Node* position, const K& key) const
+    {
+      // Keep track of parent of last upper node
+      Node* upper_node = ETL_NULLPTR;
+      // Start with position provided
+      Node* node = position;
+      while (node)
+      {
+        // Downcast position to Data_Node reference for key comparisons
+        Data_Node& data_node = imap::data_cast(*node);
+        // Compare the key value to the current upper node key value
+        if (node_comp(key, data_node))
+        {
+          upper_node = node;
+          node = node->children[kLeft];
+        }
+        else if (node_comp(data_node, key))
+        {
+          node = node->children[kRight];
+        }
+        else if (node->children[kRight])
+        {
+          upper_node = find_limit_node(node->children[kRight], kLeft);
+          break;
+        }
+        else
+        {
+          break;
+        }
+      }
+
+      // Return the upper node position found (might be ETL_NULLPTR)
+      return upper_node;
+    }
+#endif
+
     //*************************************************************************
     /// Insert a node.
     //*************************************************************************
@@ -41,6 +41,8 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "binary.h"
+#include "span.h"
 
 namespace etl
 {
@@ -70,6 +72,61 @@ namespace etl
     }
   };
 
+  namespace private_message_bus
+  {
+    //*************************************************************************
+    /// An entry in the message id index.
+    //*************************************************************************
+    struct index_entry
+    {
+      etl::message_id_t id;
+      bool              used;
+    };
+
+    //*************************************************************************
+    /// Storage for the message id index.
+    /// Each entry has a bit mask of the positions in the router list of the
+    /// routers that accept the id.
+    //*************************************************************************
+    template <size_t MAX_ROUTERS, size_t MAX_INDEXED_IDS>
+    struct index_storage
+    {
+      static ETL_CONSTANT size_t Mask_Words = (MAX_ROUTERS + 31U) / 32U;
+
+      index_entry* entries()
+      {
+        return entry_buffer;
+      }
+
+      uint32_t* masks()
+      {
+        return mask_buffer;
+      }
+
+      index_entry entry_buffer[MAX_INDEXED_IDS];
+      uint32_t    mask_buffer[MAX_INDEXED_IDS * Mask_Words];
+    };
+
+    //*************************************************************************
+    /// No index.
+    //*************************************************************************
+    template <size_t MAX_ROUTERS>
+    struct index_storage<MAX_ROUTERS, 0U>
+    {
+      static ETL_CONSTANT size_t Mask_Words = 0U;
+
+      index_entry* entries()
+      {
+        return ETL_NULLPTR;
+      }
+
+      uint32_t* masks()
+      {
+        return ETL_NULLPTR;
+      }
+    };
+  }
+
   //***************************************************************************
   /// Interface for message bus
   //***************************************************************************
@@ -105,6 +162,7 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+          clear_index();
         }
       }
 
@@ -128,6 +186,7 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+        clear_index();
       }
     }
 
@@ -141,6 +200,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        clear_index();
       }
     }
 
@@ -166,21 +226,7 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
-          {
-            etl::imessage_router& router = **irouter;
-
-            if (router.accepts(shared_msg.get_message().get_message_id()))
-            {
-              router.receive(shared_msg);
-            }
-
-            ++irouter;
-          }
-
+          broadcast(shared_msg.get_message().get_message_id(), shared_msg);
           break;
         }
 
@@ -247,21 +293,7 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
-          {
-            etl::imessage_router& router = **irouter;
-
-            if (router.accepts(message.get_message_id()))
-            {
-              router.receive(message);
-            }
-
-            ++irouter;
-          }
-
+          broadcast(message.get_message_id(), message);
           break;
         }
 
@@ -318,6 +350,18 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Broadcasts a batch of messages.
+    /// The same as calling receive(message) for each in turn.
+    //*******************************************
+    void receive(etl::span<const etl::imessage* const> messages)
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, *messages[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -338,7 +382,8 @@ namespace etl
     //*******************************************
     void clear()
     {
-      return router_list.clear();
+      router_list.clear();
+      clear_index();
     }
 
     //********************************************
@@ -366,12 +411,44 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(ETL_NULLPTR),
+        p_index_masks(ETL_NULLPTR),
+        index_size(0U),
+        mask_words(0U)
     {
     }
 
+    //*******************************************
+    /// Sets the storage for the message id index.
+    /// Called by the derived class once the storage is constructed.
+    //*******************************************
+    void set_index(private_message_bus::index_entry* p_index_,
+                   uint32_t*                         p_index_masks_,
+                   size_t                            index_size_,
+                   size_t                            mask_words_)
+    {
+      p_index       = p_index_;
+      p_index_masks = p_index_masks_;
+      index_size    = index_size_;
+      mask_words    = mask_words_;
+
+      clear_index();
+    }
+
   private:
 
+    //*******************************************
+    /// Marks every index entry as unused.
+    //*******************************************
+    void clear_index()
+    {
+      for (size_t i = 0U; i < index_size; ++i)
+      {
+        p_index[i].used = false;
+      }
+    }
+
     //*******************************************
     // How to compare routers to router ids.
     //*******************************************
@@ -388,13 +465,120 @@ namespace etl
       }
     };
 
+    //*******************************************
+    /// Sends a message to all of the routers that accept it.
+    //*******************************************
+    template <typename TMessage>
+    void broadcast(etl::message_id_t id, TMessage& message)
+    {
+      const uint32_t* p_mask = find_subscribers(id);
+
+      if (p_mask != ETL_NULLPTR)
+      {
+        // Only the routers that accept the id, in list order.
+        for (size_t word = 0U; word < mask_words; ++word)
+        {
+          uint32_t bits = p_mask[word];
+
+          while (bits != 0U)
+          {
+            const size_t position = (word * 32U) + etl::count_trailing_zeros(bits);
+            bits &= bits - 1U;
+
+            router_list[position]->receive(message);
+          }
+        }
+      }
+      else
+      {
+        router_list_t::iterator irouter = router_list.begin();
+
+        // Broadcast to everyone.
+        while (irouter != router_list.end())
+        {
+          etl::imessage_router& router = **irouter;
+
+          if (router.accepts(id))
+          {
+            router.receive(message);
+          }
+
+          ++irouter;
+        }
+      }
+    }
+
+    //*******************************************
+    /// Finds, or builds, the index entry for the id.
+    /// Returns a null pointer if there is no index or it is full.
+    /// The entries are cleared whenever the router list changes, and are
+    /// built the first time that an id is broadcast after that, so the
+    /// routers' accepts() results must not change while they are subscribed.
+    //*******************************************
+    const uint32_t* find_subscribers(etl::message_id_t id)
+    {
+      if (index_size == 0U)
+      {
+        return ETL_NULLPTR;
+      }
+
+      size_t slot = size_t(id) % index_size;
+
+      for (size_t probe = 0U; probe < index_size; ++probe)
+      {
+        private_message_bus::index_entry& entry = p_index[slot];
+        uint32_t* p_mask = p_index_masks + (slot * mask_words);
+
+        if (!entry.used)
+        {
+          entry.id   = id;
+          entry.used = true;
+
+          for (size_t word = 0U; word < mask_words; ++word)
+          {
+            p_mask[word] = 0U;
+          }
+
+          for (size_t position = 0U; position < router_list.size(); ++position)
+          {
+            if (router_list[position]->accepts(id))
+            {
+              p_mask[position / 32U] |= uint32_t(1U) << (position % 32U);
+            }
+          }
+
+          return p_mask;
+        }
+
+        if (entry.id == id)
+        {
+          return p_mask;
+        }
+
+        slot = (slot + 1U == index_size) ? 0U : slot + 1U;
+      }
+
+      // The index is full.
+      return ETL_NULLPTR;
+    }
+
     router_list_t& router_list;
+
+    private_message_bus::index_entry* p_index;
+    uint32_t*                         p_index_masks;
+    size_t                            index_size;
+    size_t                            mask_words;
   };
 
   //***************************************************************************
   /// The message bus
+  ///\tparam MAX_ROUTERS_     The maximum number of subscribed routers.
+  ///\tparam MAX_INDEXED_IDS_ The number of message ids for which the bus keeps
+  /// a list of the routers that accept them, so that broadcasts only visit
+  /// those routers. Ids beyond this are broadcast by asking every router.
+  /// Zero, the default, disables the index.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t MAX_INDEXED_IDS_ = 0U>
   class message_bus : public etl::imessage_bus
   {
   public:
@@ -405,11 +589,15 @@ namespace etl
     message_bus()
       : imessage_bus(router_list)
     {
+      set_index(index.entries(), index.masks(), MAX_INDEXED_IDS_, index_t::Mask_Words);
     }
 
   private:
 
+    typedef private_message_bus::index_storage<MAX_ROUTERS_, MAX_INDEXED_IDS_> index_t;
+
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    index_t index;
   };
 
   //***************************************************************************
@@ -0,0 +1,349 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_MAILBOX_INCLUDED
+#define ETL_MESSAGE_MAILBOX_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "message.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "optional.h"
+#include "queue_mpmc_atomic.h"
+#include "task.h"
+
+///\defgroup message_mailbox Message mailbox
+/// A queue of shared messages in front of a router, so that messages may be
+/// published without waiting for the router to handle them.
+///\ingroup messaging
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for message mailbox
+  //***************************************************************************
+  class message_mailbox_exception : public etl::exception
+  {
+  public:
+
+    message_mailbox_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A message that was not an etl::shared_message was sent to the mailbox.
+  //***************************************************************************
+  class message_mailbox_not_shared : public etl::message_mailbox_exception
+  {
+  public:
+
+    message_mailbox_not_shared(string_type file_name_, numeric_type line_number_)
+      : message_mailbox_exception(ETL_ERROR_TEXT("message mailbox:not shared", ETL_MESSAGE_MAILBOX_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// What a mailbox does with a message when it is full.
+  //***************************************************************************
+  struct message_mailbox_policy
+  {
+    enum enum_type
+    {
+      Drop_Newest, ///< The new message is dropped.
+      Drop_Oldest, ///< The oldest queued message is dropped to make room.
+      Wait         ///< The publisher waits until there is room.
+    };
+  };
+
+  //***************************************************************************
+  /// Interface for a message mailbox.
+  /// Subscribe a mailbox to an etl::message_bus in place of its router.
+  /// Messages sent as etl::shared_message are queued without copying the
+  /// message, and are passed to the router by process() or, when the mailbox
+  /// is added to an etl::scheduler, by the task interface. Publishers never
+  /// run the router's handlers.
+  /// Messages may be queued from any number of threads and processed by
+  /// any number of threads, though the router will usually expect only one.
+  /// The shared messages should use an atomic reference counter.
+  //***************************************************************************
+  class imessage_mailbox : public etl::imessage_router, public etl::task
+  {
+  public:
+
+    typedef etl::iqueue_mpmc_atomic<etl::optional<etl::shared_message> > queue_type;
+
+    using etl::imessage_router::receive;
+
+    //********************************************
+    /// Queues a shared message for the router.
+    /// Addressed and broadcast messages arrive here from imessage_router.
+    //********************************************
+    void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      if (!destination.accepts(shared_msg.get_message().get_message_id()))
+      {
+        return;
+      }
+
+      bool queued = queue.push(etl::optional<etl::shared_message>(shared_msg));
+
+      if (!queued)
+      {
+        switch (policy)
+        {
+          case etl::message_mailbox_policy::Drop_Oldest:
+          {
+            while (!queued)
+            {
+              if (queue.pop())
+              {
+                dropped.fetch_add(1U, etl::memory_order_relaxed);
+              }
+
+              queued = queue.push(etl::optional<etl::shared_message>(shared_msg));
+            }
+            break;
+          }
+
+          case etl::message_mailbox_policy::Wait:
+          {
+            while (!queued)
+            {
+              queued = queue.push(etl::optional<etl::shared_message>(shared_msg));
+            }
+            break;
+          }
+
+          case etl::message_mailbox_policy::Drop_Newest:
+          default:
+          {
+            dropped.fetch_add(1U, etl::memory_order_relaxed);
+            break;
+          }
+        }
+      }
+
+      if (queued)
+      {
+        task_set_ready();
+      }
+    }
+
+    //********************************************
+    /// Only shared messages may be queued.
+    //********************************************
+    void receive(const etl::imessage&) ETL_OVERRIDE
+    {
+      ETL_ALWAYS_ASSERT(ETL_ERROR(etl::message_mailbox_not_shared));
+    }
+
+    //********************************************
+    /// Passes up to 'max_count' queued messages to the router.
+    /// Returns the number passed.
+    //********************************************
+    size_t process(size_t max_count)
+    {
+      size_t count = 0U;
+
+      while ((count < max_count) && process_one())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //********************************************
+    /// Passes all of the queued messages to the router.
+    /// Returns the number passed.
+    //********************************************
+    size_t process()
+    {
+      size_t count = 0U;
+
+      while (process_one())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //********************************************
+    /// The number of messages dropped because the mailbox was full.
+    //********************************************
+    uint32_t dropped_count() const
+    {
+      return dropped.load(etl::memory_order_relaxed);
+    }
+
+    //********************************************
+    /// The number of queued messages.
+    //********************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+    //********************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //********************************************
+    etl::imessage_router& get_destination()
+    {
+      return destination;
+    }
+
+    //********************************************
+    /// Accepts the same messages as the router.
+    //********************************************
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return destination.accepts(id);
+    }
+
+    using imessage_router::accepts;
+
+    //********************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //********************************************
+    /// Task interface. The amount of work is the number of queued messages.
+    //********************************************
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return uint32_t(queue.size());
+    }
+
+    //********************************************
+    /// Task interface. Passes one message to the router.
+    //********************************************
+    void task_process_work() ETL_OVERRIDE
+    {
+      process_one();
+    }
+
+  protected:
+
+    //********************************************
+    /// Constructor.
+    /// The mailbox has the same id as the router.
+    //********************************************
+    imessage_mailbox(etl::imessage_router&                        destination_,
+                     queue_type&                                  queue_,
+                     etl::message_mailbox_policy::enum_type       policy_,
+                     etl::task_priority_t                         priority_)
+      : imessage_router(destination_.get_message_router_id())
+      , task(priority_)
+      , destination(destination_)
+      , queue(queue_)
+      , policy(policy_)
+      , dropped(0U)
+    {
+    }
+
+  private:
+
+    //********************************************
+    bool process_one()
+    {
+      etl::optional<etl::shared_message> shared_msg;
+
+      if (queue.pop(shared_msg))
+      {
+        destination.receive(shared_msg.value());
+        return true;
+      }
+
+      return false;
+    }
+
+    etl::imessage_router&                  destination;
+    queue_type&                            queue;
+    etl::message_mailbox_policy::enum_type policy;
+    etl::atomic<uint32_t>                  dropped;
+  };
+
+  //***************************************************************************
+  /// A message mailbox.
+  ///\tparam SIZE The maximum number of queued messages. Must be a power of 2.
+  //***************************************************************************
+  template <size_t SIZE>
+  class message_mailbox : public etl::imessage_mailbox
+  {
+  public:
+
+    //********************************************
+    /// Constructor.
+    //********************************************
+    message_mailbox(etl::imessage_router&                  destination_,
+                    etl::message_mailbox_policy::enum_type policy_   = etl::message_mailbox_policy::Drop_Newest,
+                    etl::task_priority_t                   priority_ = 0U)
+      : imessage_mailbox(destination_, mailbox_queue, policy_, priority_)
+    {
+    }
+
+  private:
+
+    etl::queue_mpmc_atomic<etl::optional<etl::shared_message>, SIZE> mailbox_queue;
+  };
+}
+
+#endif
+#endif
@@ -66,6 +66,7 @@ SOFTWARE.
 #include "placement_new.h"
 #include "successor.h"
 #include "type_traits.h"
+#include "private/message_id_lookup.h"
 
 namespace etl
 {
@@ -352,19 +353,28 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
-
-      if (!was_handled)
+      if constexpr (sizeof...(TMessageTypes) != 0U)
       {
-        if (has_successor())
-        {
-          get_successor().receive(msg);
-        }
-        else
+        const size_t index = message_id_lookup::find(msg.get_message_id());
+
+        if (index != message_id_lookup::npos)
         {
-          static_cast<TDerived*>(this)->on_receive_unknown(msg);
+          // Jump straight to the handler for the message type.
+          static constexpr handler_t handlers[] = { &message_router::template receive_message_type<TMessageTypes>... };
+
+          handlers[index](*static_cast<TDerived*>(this), msg);
+          return;
         }
       }
+
+      if (has_successor())
+      {
+        get_successor().receive(msg);
+      }
+      else
+      {
+        static_cast<TDerived*>(this)->on_receive_unknown(msg);
+      }
     }
 
     template <typename TMessage, typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value, int>::type = 0>
@@ -392,7 +402,14 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (message_id_lookup::find(id) != message_id_lookup::npos)
+      {
+        return true;
+      }
+      else
+      {
+        return has_successor() && get_successor().accepts(id);
+      }
     }
 
     //********************************************
@@ -415,40 +432,15 @@ namespace etl
 
   private:
 
-    //********************************************
-    template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
-    {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
+    typedef etl::private_message_router::message_id_lookup<TMessageTypes...> message_id_lookup;
+
+    typedef void (*handler_t)(TDerived&, const etl::imessage&);
 
     //********************************************
     template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    static void receive_message_type(TDerived& derived, const etl::imessage& msg)
     {
-      if (TMessage::ID == id)
-      {
-        return true;
-      }
-      else
-      {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
-      }
+      derived.on_receive(static_cast<const TMessage&>(msg));
     }
   };
 #else
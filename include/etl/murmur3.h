@@ -36,7 +36,10 @@ SOFTWARE.
 #include "platform.h"
 #include "ihash.h"
 #include "binary.h"
+#include "array.h"
+#include "iterator.h"
 #include "error_handler.h"
+#include "private/is_contiguous_iterator.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -88,19 +91,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8U);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -126,19 +117,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8U);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end, etl::integral_constant<bool, etl::private_iterator::is_contiguous_iterator<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -151,16 +130,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8U);
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block = 0;
-      }
-
-      ++char_count;
+      add_byte(value_);
     }
 
     //*************************************************************************
@@ -182,6 +152,74 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a whole block at a time where possible.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end, etl::true_type)
+    {
+      if (begin == end)
+      {
+        return;
+      }
+
+      const uint8_t* data   = reinterpret_cast<const uint8_t*>(&*begin);
+      size_t         length = size_t(end - begin);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0U) && (length != 0U))
+      {
+        add_byte(*data++);
+        --length;
+      }
+
+      while (length >= FULL_BLOCK)
+      {
+        block = value_type(uint32_t(data[0]) | (uint32_t(data[1]) << 8U) | (uint32_t(data[2]) << 16U) | (uint32_t(data[3]) << 24U));
+        add_block();
+        block = 0;
+
+        char_count += FULL_BLOCK;
+        data       += FULL_BLOCK;
+        length     -= FULL_BLOCK;
+      }
+
+      while (length != 0U)
+      {
+        add_byte(*data++);
+        --length;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8U);
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block();
+        block_fill_count = 0;
+        block = 0;
+      }
+
+      ++char_count;
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -234,6 +272,276 @@ namespace etl
     static ETL_CONSTANT value_type MULTIPLY   = 5;
     static ETL_CONSTANT value_type ADD        = 0xE6546B64UL;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the 128 bit x64 variant of the murmur3 hash.
+  /// The hash is returned as two 64 bit values.
+  /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128
+  {
+  public:
+
+    typedef etl::array<uint64_t, 2U> value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x64_128(uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      hash[0]          = seed;
+      hash[1]          = seed;
+      char_count       = 0;
+      block[0]         = 0;
+      block[1]         = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add(begin, end, etl::integral_constant<bool, etl::private_iterator::is_contiguous_iterator<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_byte(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a whole block at a time where possible.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end, etl::true_type)
+    {
+      if (begin == end)
+      {
+        return;
+      }
+
+      const uint8_t* data   = reinterpret_cast<const uint8_t*>(&*begin);
+      size_t         length = size_t(end - begin);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0U) && (length != 0U))
+      {
+        add_byte(*data++);
+        --length;
+      }
+
+      while (length >= FULL_BLOCK)
+      {
+        block[0] = load(data);
+        block[1] = load(data + 8U);
+        add_block();
+        block[0] = 0;
+        block[1] = 0;
+
+        char_count += FULL_BLOCK;
+        data       += FULL_BLOCK;
+        length     -= FULL_BLOCK;
+      }
+
+      while (length != 0U)
+      {
+        add_byte(*data++);
+        --length;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block[block_fill_count / 8U] |= uint64_t(value_) << ((block_fill_count % 8U) * 8U);
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block();
+        block_fill_count = 0;
+        block[0] = 0;
+        block[1] = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Loads a little endian 64 bit value.
+    //*************************************************************************
+    static uint64_t load(const uint8_t* data)
+    {
+      return  uint64_t(data[0])         | (uint64_t(data[1]) << 8U)  | (uint64_t(data[2]) << 16U) | (uint64_t(data[3]) << 24U) |
+             (uint64_t(data[4]) << 32U) | (uint64_t(data[5]) << 40U) | (uint64_t(data[6]) << 48U) | (uint64_t(data[7]) << 56U);
+    }
+
+    //*************************************************************************
+    /// Mixes the block values.
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= CONSTANT1;
+      k1  = rotate_left(k1, 31);
+      k1 *= CONSTANT2;
+
+      return k1;
+    }
+
+    static uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= CONSTANT2;
+      k2  = rotate_left(k2, 33);
+      k2 *= CONSTANT1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    /// The final avalanche.
+    //*************************************************************************
+    static uint64_t fmix(uint64_t k)
+    {
+      k ^= (k >> 33U);
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= (k >> 33U);
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= (k >> 33U);
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block()
+    {
+      hash[0] ^= mix_k1(block[0]);
+      hash[0]  = rotate_left(hash[0], 27);
+      hash[0] += hash[1];
+      hash[0]  = (hash[0] * 5U) + 0x52DCE729ULL;
+
+      hash[1] ^= mix_k2(block[1]);
+      hash[1]  = rotate_left(hash[1], 31);
+      hash[1] += hash[0];
+      hash[1]  = (hash[1] * 5U) + 0x38495AB5ULL;
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        // A partial block is mixed without the rotate and multiply of a full block.
+        hash[1] ^= mix_k2(block[1]);
+        hash[0] ^= mix_k1(block[0]);
+
+        hash[0] ^= uint64_t(char_count);
+        hash[1] ^= uint64_t(char_count);
+
+        hash[0] += hash[1];
+        hash[1] += hash[0];
+
+        hash[0] = fmix(hash[0]);
+        hash[1] = fmix(hash[1]);
+
+        hash[0] += hash[1];
+        hash[1] += hash[0];
+
+        is_finalised = true;
+      }
+    }
+
+    bool       is_finalised;
+    uint8_t    block_fill_count;
+    size_t     char_count;
+    uint64_t   block[2];
+    value_type hash;
+    uint32_t   seed;
+
+    static ETL_CONSTANT uint8_t  FULL_BLOCK = 16U;
+    static ETL_CONSTANT uint64_t CONSTANT1  = 0x87C37B91114253D5ULL;
+    static ETL_CONSTANT uint64_t CONSTANT2  = 0x4CF5AD432745937FULL;
+  };
+#endif
 }
 
 #endif
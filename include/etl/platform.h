@@ -211,6 +211,60 @@ SOFTWARE.
   #define ETL_CONSTINIT
 #endif
 
+// Determine the SIMD instruction sets that may be used, if haven't already done so in etl_profile.h
+// Define ETL_NO_SIMD to use only the portable implementations.
+#if !defined(ETL_USING_SSE2)
+  #if !defined(ETL_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #define ETL_USING_SSE2 1
+  #else
+    #define ETL_USING_SSE2 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_NEON)
+  #if !defined(ETL_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_NEON 1
+  #else
+    #define ETL_USING_NEON 0
+  #endif
+#endif
+
+// Determine the CRC instructions that may be used, if haven't already done so in etl_profile.h
+#if !defined(ETL_USING_SSE4_2)
+  #if !defined(ETL_NO_SIMD) && (defined(__SSE4_2__) || (defined(ETL_COMPILER_MICROSOFT) && defined(__AVX__)))
+    #define ETL_USING_SSE4_2 1
+  #else
+    #define ETL_USING_SSE4_2 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_PCLMUL)
+  #if !defined(ETL_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64)) && \
+      ((defined(__PCLMUL__) && defined(__SSSE3__)) || (defined(ETL_COMPILER_MICROSOFT) && defined(__AVX__)))
+    #define ETL_USING_PCLMUL 1
+  #else
+    #define ETL_USING_PCLMUL 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_ARM_CRC32)
+  #if !defined(ETL_NO_SIMD) && defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_ARM_CRC32 1
+  #else
+    #define ETL_USING_ARM_CRC32 0
+  #endif
+#endif
+
+// The cache line size used to keep data written by different threads apart, if haven't already done so in etl_profile.h
+// Zero disables the padding, for targets without a data cache.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86) || defined(__aarch64__) || defined(_M_ARM64)
+    #define ETL_CACHE_LINE_SIZE 64
+  #else
+    #define ETL_CACHE_LINE_SIZE 0
+  #endif
+#endif
+
 // Sort out namespaces for STL/No STL options.
 #include "private/choose_namespace.h"
 
@@ -0,0 +1,64 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPARATOR_IS_TRANSPARENT_INCLUDED
+#define ETL_COMPARATOR_IS_TRANSPARENT_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Checks whether a comparator, hasher or key equality functor defines
+  /// 'is_transparent', allowing lookups with types other than the key type.
+  //***************************************************************************
+  template <typename T>
+  struct comparator_is_transparent
+  {
+  private:
+
+    typedef char(&yes)[1];
+    typedef char(&no)[2];
+
+    template <typename U>
+    static yes test(typename U::is_transparent*);
+
+    template <typename U>
+    static no test(...);
+
+  public:
+
+    static ETL_CONSTANT bool value = (sizeof(test<T>(0)) == sizeof(yes));
+  };
+}
+
+#endif
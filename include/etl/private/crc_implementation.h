@@ -38,15 +38,44 @@ SOFTWARE.
 #include "../type_traits.h"
 
 #include "stdint.h"
+#include "string.h"
 
 #include "crc_parameters.h"
 
+#if ETL_USING_SSE4_2
+  #include <nmmintrin.h>
+#endif
+
+#if ETL_USING_PCLMUL
+  #include <tmmintrin.h>
+  #include <wmmintrin.h>
+#endif
+
+#if ETL_USING_ARM_CRC32
+  #include <arm_acle.h>
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
 
 namespace etl
 {
+  //*****************************************************************************
+  /// The Table_Size for crc_type that selects the accelerated policy.
+  /// Uses the target's CRC or carry-less multiply instructions where they are
+  /// enabled, otherwise a slicing-by-8 table.
+  //*****************************************************************************
+  static ETL_CONSTANT size_t crc_accelerated = 0U;
+
+  //*****************************************************************************
+  /// The Table_Size values for crc_type that select the slicing-by-N tables.
+  /// Each processes N bytes per step, using N tables of 256 entries.
+  //*****************************************************************************
+  static ETL_CONSTANT size_t crc_slicing_by_4  = 4U * 256U;
+  static ETL_CONSTANT size_t crc_slicing_by_8  = 8U * 256U;
+  static ETL_CONSTANT size_t crc_slicing_by_16 = 16U * 256U;
+
   namespace private_crc
   {
     //*****************************************************************************
@@ -557,6 +586,389 @@ namespace etl
       }
     };
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The value of the accumulator after byte 'Index' followed by 'Slice' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous       = crc_slice_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+      static ETL_CONSTANT size_t       Previous_Index = Reflect ? size_t(Previous & 0xFFU) : size_t(Previous >> (Accumulator_Bits - 8U));
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator(TAccumulator(Reflect ? (Previous >> 8U) : (Previous << 8U)) ^
+                                                            crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Previous_Index, 8U>::value);
+    };
+
+    //*********************************
+    // The first slice is the 256 entry table.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Table
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+    struct crc_slice_table
+    {
+      static const TAccumulator table[256U];
+    };
+
+#define ETL_CRC_SLICE_ENTRY(Index)    crc_slice_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, (Index), Slice>::value
+#define ETL_CRC_SLICE_ENTRIES_4(Index)  ETL_CRC_SLICE_ENTRY(Index),               ETL_CRC_SLICE_ENTRY(Index + 1U),            ETL_CRC_SLICE_ENTRY(Index + 2U),            ETL_CRC_SLICE_ENTRY(Index + 3U)
+#define ETL_CRC_SLICE_ENTRIES_16(Index) ETL_CRC_SLICE_ENTRIES_4(Index),           ETL_CRC_SLICE_ENTRIES_4(Index + 4U),        ETL_CRC_SLICE_ENTRIES_4(Index + 8U),        ETL_CRC_SLICE_ENTRIES_4(Index + 12U)
+#define ETL_CRC_SLICE_ENTRIES_64(Index) ETL_CRC_SLICE_ENTRIES_16(Index),          ETL_CRC_SLICE_ENTRIES_16(Index + 16U),      ETL_CRC_SLICE_ENTRIES_16(Index + 32U),      ETL_CRC_SLICE_ENTRIES_16(Index + 48U)
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+    const TAccumulator crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice>::table[256U] =
+    {
+      ETL_CRC_SLICE_ENTRIES_64(0U), ETL_CRC_SLICE_ENTRIES_64(64U), ETL_CRC_SLICE_ENTRIES_64(128U), ETL_CRC_SLICE_ENTRIES_64(192U)
+    };
+
+#undef ETL_CRC_SLICE_ENTRY
+#undef ETL_CRC_SLICE_ENTRIES_4
+#undef ETL_CRC_SLICE_ENTRIES_16
+#undef ETL_CRC_SLICE_ENTRIES_64
+
+    //*****************************************************************************
+    /// CRC Slice Block
+    /// Combines the byte at 'Index' of a block of 'Slices' bytes with the
+    /// accumulator and looks it up in the table for the bytes that follow it.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices, size_t Index>
+    struct crc_slice_block
+    {
+      static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+      static ETL_CONSTANT bool   In_Accumulator    = (Index < Accumulator_Bytes);
+      static ETL_CONSTANT size_t Shift             = In_Accumulator ? (Reflect ? (8U * Index) : (Accumulator_Bits - 8U - (8U * Index))) : 0U;
+
+      static TAccumulator add(TAccumulator crc, const uint8_t* data)
+      {
+        const uint8_t crc_byte = In_Accumulator ? uint8_t(crc >> Shift) : uint8_t(0U);
+
+        return TAccumulator(crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices - 1U - Index>::table[uint8_t(data[Index] ^ crc_byte)] ^
+                            crc_slice_block<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Index + 1U>::add(crc, data));
+      }
+    };
+
+    //*********************************
+    // The part of the accumulator that is not shifted out by the block.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_block<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Slices>
+    {
+      static ETL_CONSTANT bool   Has_Remainder = (Accumulator_Bits > (8U * Slices));
+      static ETL_CONSTANT size_t Shift         = Has_Remainder ? (8U * Slices) : 0U;
+
+      static TAccumulator add(TAccumulator crc, const uint8_t*)
+      {
+        if ETL_IF_CONSTEXPR(Has_Remainder)
+        {
+          return Reflect ? TAccumulator(crc >> Shift) : TAccumulator(crc << Shift);
+        }
+        else
+        {
+          return TAccumulator(0U);
+        }
+      }
+    };
+
+    //*****************************************************************************
+    /// CRC Slicing
+    /// Processes a block of 'Slices' bytes per step, using one table per byte.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slicing
+    {
+      ETL_STATIC_ASSERT((Slices == 4U) || (Slices == 8U) || (Slices == 16U), "Slices must be 4, 8 or 16");
+
+      //*************************************************************************
+      static TAccumulator add(TAccumulator crc, uint8_t value)
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U>::table);
+      }
+
+      //*************************************************************************
+      static TAccumulator add(TAccumulator crc, const uint8_t* data, size_t length)
+      {
+        while (length >= Slices)
+        {
+          crc = crc_slice_block<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, 0U>::add(crc, data);
+
+          data   += Slices;
+          length -= Slices;
+        }
+
+        while (length != 0U)
+        {
+          crc = add(crc, *data++);
+          --length;
+        }
+
+        return crc;
+      }
+    };
+
+#if ETL_USING_PCLMUL
+    //*****************************************************************************
+    /// x^N mod P, for the non-reflected polynomial.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t N, bool Is_Remainder = (N < Accumulator_Bits)>
+    class crc_x_pow_mod
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous = crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, N - 8U>::value;
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator(TAccumulator(Previous << 8U) ^
+                                                            crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false, size_t(Previous >> (Accumulator_Bits - 8U)), 8U>::value);
+    };
+
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t N>
+    class crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, N, true>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator(TAccumulator(1U) << N);
+    };
+
+    //*****************************************************************************
+    /// The multipliers that fold a 128 bit block forward by Distance bits.
+    /// The reflected multipliers are bit reversed and include the x^-1 that
+    /// compensates for the reflected carry-less multiply.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Distance>
+    struct crc_fold_multipliers
+    {
+      static ETL_CONSTANT uint64_t High = Reflect ? etl::reverse_bits_const<uint64_t, uint64_t(crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Distance - 1U>::value)>::value
+                                                  : uint64_t(crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Distance + 64U>::value);
+
+      static ETL_CONSTANT uint64_t Low  = Reflect ? etl::reverse_bits_const<uint64_t, uint64_t(crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Distance + 63U>::value)>::value
+                                                  : uint64_t(crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Distance>::value);
+
+      static __m128i get()
+      {
+        return _mm_set_epi64x(int64_t(High), int64_t(Low));
+      }
+    };
+
+    //*****************************************************************************
+    /// Carry-less multiply folding.
+    /// Folds whole 64 byte blocks down to a 16 byte remainder that has the same CRC.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_clmul_fold
+    {
+      //*************************************************************************
+      /// Folds as many 64 byte blocks as possible, writing the remainder to 'remainder'.
+      /// 'length' must be at least 64. Returns the number of bytes consumed.
+      //*************************************************************************
+      static size_t fold(TAccumulator crc, const uint8_t* data, size_t length, uint8_t remainder[16U])
+      {
+        const __m128i k512 = crc_fold_multipliers<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 512U>::get();
+
+        const uint8_t* const start = data;
+
+        __m128i x0 = load(data);
+        __m128i x1 = load(data + 16U);
+        __m128i x2 = load(data + 32U);
+        __m128i x3 = load(data + 48U);
+
+        // Combine the accumulator with the first bytes of the data.
+        if ETL_IF_CONSTEXPR(Reflect)
+        {
+          x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, int64_t(uint64_t(crc))));
+        }
+        else
+        {
+          x0 = _mm_xor_si128(x0, _mm_set_epi64x(int64_t(uint64_t(crc) << (64U - Accumulator_Bits)), 0));
+        }
+
+        data   += 64U;
+        length -= 64U;
+
+        while (length >= 64U)
+        {
+          x0 = fold_16(x0, k512, load(data));
+          x1 = fold_16(x1, k512, load(data + 16U));
+          x2 = fold_16(x2, k512, load(data + 32U));
+          x3 = fold_16(x3, k512, load(data + 48U));
+
+          data   += 64U;
+          length -= 64U;
+        }
+
+        // Fold the four lanes into one.
+        x3 = fold_16(x2, crc_fold_multipliers<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 128U>::get(), x3);
+        x3 = fold_16(x1, crc_fold_multipliers<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 256U>::get(), x3);
+        x3 = fold_16(x0, crc_fold_multipliers<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 384U>::get(), x3);
+
+        store(remainder, x3);
+
+        return size_t(data - start);
+      }
+
+    private:
+
+      //*************************************************************************
+      static __m128i fold_16(__m128i value, __m128i multipliers, __m128i next)
+      {
+        return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, multipliers, 0x11),
+                                           _mm_clmulepi64_si128(value, multipliers, 0x00)),
+                             next);
+      }
+
+      //*************************************************************************
+      /// Non-reflected CRCs need the first byte as the most significant.
+      //*************************************************************************
+      static __m128i load(const uint8_t* data)
+      {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+        if ETL_IF_CONSTEXPR(!Reflect)
+        {
+          value = _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+
+        return value;
+      }
+
+      //*************************************************************************
+      static void store(uint8_t* data, __m128i value)
+      {
+        if ETL_IF_CONSTEXPR(!Reflect)
+        {
+          value = _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+      }
+    };
+#endif
+
+    //*****************************************************************************
+    /// CRC Accelerated
+    /// Uses the CRC instructions for CRC32-C and CRC32, and carry-less multiply
+    /// folding for large blocks, where enabled. Slicing-by-8 otherwise.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_accelerated_table
+    {
+      typedef crc_slicing<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U> slicing_t;
+
+      static ETL_CONSTANT bool Is_Crc32_C = (Accumulator_Bits == 32U) && Reflect && (uint64_t(Polynomial) == 0x1EDC6F41ULL);
+      static ETL_CONSTANT bool Is_Crc32   = (Accumulator_Bits == 32U) && Reflect && (uint64_t(Polynomial) == 0x04C11DB7ULL);
+
+      //*************************************************************************
+      static TAccumulator add(TAccumulator crc, uint8_t value)
+      {
+        return slicing_t::add(crc, value);
+      }
+
+      //*************************************************************************
+      static TAccumulator add(TAccumulator crc, const uint8_t* data, size_t length)
+      {
+#if ETL_USING_PCLMUL
+        // Large blocks are folded down to 16 bytes.
+        if (length >= 128U)
+        {
+          uint8_t remainder[16U];
+
+          size_t consumed = crc_clmul_fold<TAccumulator, Accumulator_Bits, Polynomial, Reflect>::fold(crc, data, length, remainder);
+
+          crc     = add_bytes(TAccumulator(0U), remainder, 16U);
+          data   += consumed;
+          length -= consumed;
+        }
+#endif
+
+        return add_bytes(crc, data, length);
+      }
+
+    private:
+
+      //*************************************************************************
+      static TAccumulator add_bytes(TAccumulator crc, const uint8_t* data, size_t length)
+      {
+#if ETL_USING_SSE4_2
+        if ETL_IF_CONSTEXPR(Is_Crc32_C)
+        {
+  #if ETL_PLATFORM_64BIT
+          uint64_t crc64 = uint64_t(crc);
+
+          while (length >= 8U)
+          {
+            uint64_t block;
+            memcpy(&block, data, 8U);
+            crc64 = _mm_crc32_u64(crc64, block);
+            data   += 8U;
+            length -= 8U;
+          }
+
+          uint32_t crc32 = uint32_t(crc64);
+  #else
+          uint32_t crc32 = uint32_t(crc);
+
+          while (length >= 4U)
+          {
+            uint32_t block;
+            memcpy(&block, data, 4U);
+            crc32 = _mm_crc32_u32(crc32, block);
+            data   += 4U;
+            length -= 4U;
+          }
+  #endif
+
+          while (length != 0U)
+          {
+            crc32 = _mm_crc32_u8(crc32, *data++);
+            --length;
+          }
+
+          return TAccumulator(crc32);
+        }
+#endif
+
+#if ETL_USING_ARM_CRC32
+        if ETL_IF_CONSTEXPR(Is_Crc32_C || Is_Crc32)
+        {
+          uint32_t crc32 = uint32_t(crc);
+
+          while (length >= 8U)
+          {
+            uint64_t block;
+            memcpy(&block, data, 8U);
+            crc32 = Is_Crc32_C ? __crc32cd(crc32, block) : __crc32d(crc32, block);
+            data   += 8U;
+            length -= 8U;
+          }
+
+          while (length != 0U)
+          {
+            crc32 = Is_Crc32_C ? __crc32cb(crc32, *data) : __crc32b(crc32, *data);
+            ++data;
+            --length;
+          }
+
+          return TAccumulator(crc32);
+        }
+#endif
+
+        return slicing_t::add(crc, data, length);
+      }
+    };
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
@@ -619,6 +1031,74 @@ namespace etl
       }
     };
 
+    //*********************************
+    // Policy for the slicing tables.
+    template <typename TCrcParameters, size_t Slices>
+    struct crc_slicing_policy : public crc_slicing<typename TCrcParameters::accumulator_type,
+                                                   TCrcParameters::Accumulator_Bits,
+                                                   TCrcParameters::Polynomial,
+                                                   TCrcParameters::Reflect,
+                                                   Slices>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+      typedef void block_add_supported;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, etl::crc_slicing_by_4> : public crc_slicing_policy<TCrcParameters, 4U>
+    {
+    };
+
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, etl::crc_slicing_by_8> : public crc_slicing_policy<TCrcParameters, 8U>
+    {
+    };
+
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, etl::crc_slicing_by_16> : public crc_slicing_policy<TCrcParameters, 16U>
+    {
+    };
+
+    //*********************************
+    // Policy for the accelerated implementation.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, etl::crc_accelerated> : public crc_accelerated_table<typename TCrcParameters::accumulator_type,
+                                                                                          TCrcParameters::Accumulator_Bits,
+                                                                                          TCrcParameters::Polynomial,
+                                                                                          TCrcParameters::Reflect>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+      typedef void block_add_supported;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
     //*********************************
     // Policy for 4 entry table.
     template <typename TCrcParameters>
@@ -646,6 +1126,129 @@ namespace etl
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+    //*****************************************************************************
+    /// CRC Combiner
+    /// Combines the CRCs of two consecutive blocks, using GF(2) matrices that
+    /// advance the accumulator over runs of zero bits.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_combiner
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t Accumulator_Bits = TCrcParameters::Accumulator_Bits;
+
+      //*************************************************************************
+      /// Returns the CRC of the concatenated blocks.
+      //*************************************************************************
+      static accumulator_type combine(accumulator_type crc1, accumulator_type crc2, size_t length2)
+      {
+        const accumulator_type initial = TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                                                 : TCrcParameters::Initial;
+
+        // The initial value and output xor of the second block are already in crc2.
+        return accumulator_type(shift(accumulator_type(crc1 ^ TCrcParameters::Xor_Out ^ initial), length2) ^ crc2);
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Advances the accumulator over 'length' zero bytes.
+      //*************************************************************************
+      static accumulator_type shift(accumulator_type crc, size_t length)
+      {
+        if (length == 0U)
+        {
+          return crc;
+        }
+
+        accumulator_type even[Accumulator_Bits];
+        accumulator_type odd[Accumulator_Bits];
+
+        // The operator for one zero bit.
+        for (size_t i = 0U; i < Accumulator_Bits; ++i)
+        {
+          if ETL_IF_CONSTEXPR(TCrcParameters::Reflect)
+          {
+            odd[i] = (i == 0U) ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Polynomial>::value : accumulator_type(accumulator_type(1U) << (i - 1U));
+          }
+          else
+          {
+            odd[i] = (i == (Accumulator_Bits - 1U)) ? TCrcParameters::Polynomial : accumulator_type(accumulator_type(1U) << (i + 1U));
+          }
+        }
+
+        square(even, odd); // Two zero bits.
+        square(odd, even); // Four zero bits.
+
+        // Apply the operators for one, two, four... zero bytes for each bit set in the length.
+        while (true)
+        {
+          square(even, odd);
+
+          if ((length & 1U) != 0U)
+          {
+            crc = times(even, crc);
+          }
+
+          length >>= 1U;
+
+          if (length == 0U)
+          {
+            break;
+          }
+
+          square(odd, even);
+
+          if ((length & 1U) != 0U)
+          {
+            crc = times(odd, crc);
+          }
+
+          length >>= 1U;
+
+          if (length == 0U)
+          {
+            break;
+          }
+        }
+
+        return crc;
+      }
+
+      //*************************************************************************
+      /// Multiplies a vector by a matrix.
+      //*************************************************************************
+      static accumulator_type times(const accumulator_type* matrix, accumulator_type vector)
+      {
+        accumulator_type sum = 0U;
+
+        while (vector != 0U)
+        {
+          if ((vector & 1U) != 0U)
+          {
+            sum ^= *matrix;
+          }
+
+          vector >>= 1U;
+          ++matrix;
+        }
+
+        return sum;
+      }
+
+      //*************************************************************************
+      /// Squares a matrix.
+      //*************************************************************************
+      static void square(accumulator_type* result, const accumulator_type* matrix)
+      {
+        for (size_t i = 0U; i < Accumulator_Bits; ++i)
+        {
+          result[i] = times(matrix, matrix[i]);
+        }
+      }
+    };
   }
 
   //*****************************************************************************
@@ -656,7 +1259,11 @@ namespace etl
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    typedef TCrcParameters parameters_type;
+
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) ||
+                      (Table_Size == etl::crc_slicing_by_4) || (Table_Size == etl::crc_slicing_by_8) || (Table_Size == etl::crc_slicing_by_16) ||
+                      (Table_Size == etl::crc_accelerated), "Table size must be 4, 16, 256, a slicing table size or etl::crc_accelerated");
 
     //*************************************************************************
     /// Default constructor.
@@ -678,6 +1285,20 @@ namespace etl
       this->add(begin, end);
     }
   };
+
+  //*****************************************************************************
+  /// Combines the CRCs of two consecutive blocks into the CRC of both.
+  /// e.g. etl::crc_combine<etl::crc32>(crc1, crc2, length2)
+  ///	param TCrc    The CRC type.
+  ///\param crc1    The CRC of the first block.
+  ///\param crc2    The CRC of the second block.
+  ///\param length2 The length of the second block, in bytes.
+  //*****************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc1, typename TCrc::value_type crc2, size_t length2)
+  {
+    return private_crc::crc_combiner<typename TCrc::parameters_type>::combine(crc1, crc2, length2);
+  }
 }
 
 #endif
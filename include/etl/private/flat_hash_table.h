@@ -0,0 +1,753 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#if !defined(ETL_IN_FLAT_HASH_MAP_H) && !defined(ETL_IN_FLAT_HASH_SET_H)
+#error This header is a private element of etl::flat_hash_map & etl::flat_hash_set
+#endif
+
+#ifndef ETL_FLAT_HASH_TABLE_INCLUDED
+#define ETL_FLAT_HASH_TABLE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../log.h"
+#include "../power.h"
+#include "../binary.h"
+#include "../type_traits.h"
+#include "../parameter_type.h"
+#include "../debug_count.h"
+#include "../placement_new.h"
+
+#if ETL_USING_SSE2
+  #include <emmintrin.h>
+#elif ETL_USING_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Fibonacci hashing multipliers for each size of size_t.
+    /// Spreads poorly distributed hashes (such as the identity hash of the
+    /// integral types) across the whole table.
+    //*************************************************************************
+    template <size_t Size_Of_Size_T = sizeof(size_t)>
+    struct fibonacci_multiplier;
+
+    template <>
+    struct fibonacci_multiplier<2U>
+    {
+      static ETL_CONSTANT size_t value = 40503U;
+    };
+
+    template <>
+    struct fibonacci_multiplier<4U>
+    {
+      static ETL_CONSTANT size_t value = 2654435769UL;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct fibonacci_multiplier<8U>
+    {
+      static ETL_CONSTANT size_t value = static_cast<size_t>(11400714819323198485ULL);
+    };
+#endif
+
+    //*************************************************************************
+    /// The metadata for each slot.
+    //*************************************************************************
+    struct slot_metadata
+    {
+      uint8_t distance; ///< The probe distance + 1. 0 is empty.
+      uint8_t tag;      ///< Hash bits below those that select the home slot.
+    };
+
+    //*************************************************************************
+    /// Group probing.
+    /// Compares the metadata of a group of consecutive slots in one step,
+    /// returning a mask with a set bit for each slot that could hold the key.
+    /// Only those slots need a call to key_equal.
+    /// The slot in lane 'n' matches if its distance is 'distance + n' and its
+    /// tag is 'tag'.
+    //*************************************************************************
+#if ETL_USING_SSE2
+    struct group
+    {
+      typedef uint32_t mask_t;
+
+      static ETL_CONSTANT size_t Size = 16U;
+
+      static mask_t match(const slot_metadata* pmetadata, uint8_t distance, uint8_t tag)
+      {
+        // Each slot is compared as a 16 bit little endian value.
+        const __m128i base          = _mm_set1_epi16(static_cast<short>((tag << 8U) | distance));
+        const __m128i expected_low  = _mm_add_epi16(base, _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7));
+        const __m128i expected_high = _mm_add_epi16(base, _mm_setr_epi16(8, 9, 10, 11, 12, 13, 14, 15));
+
+        const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pmetadata));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pmetadata + 8U));
+
+        const __m128i matches = _mm_packs_epi16(_mm_cmpeq_epi16(low, expected_low), _mm_cmpeq_epi16(high, expected_high));
+
+        return static_cast<mask_t>(_mm_movemask_epi8(matches));
+      }
+
+      static size_t lane(mask_t mask)
+      {
+        return etl::count_trailing_zeros(mask);
+      }
+    };
+#elif ETL_USING_NEON
+    struct group
+    {
+      typedef uint64_t mask_t;
+
+      static ETL_CONSTANT size_t Size = 16U;
+
+      static mask_t match(const slot_metadata* pmetadata, uint8_t distance, uint8_t tag)
+      {
+        static const uint8_t lane_offsets[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+        // Splits the distances and tags.
+        const uint8x16x2_t metadata = vld2q_u8(reinterpret_cast<const uint8_t*>(pmetadata));
+
+        const uint8x16_t expected = vaddq_u8(vdupq_n_u8(distance), vld1q_u8(lane_offsets));
+        const uint8x16_t matches  = vandq_u8(vceqq_u8(metadata.val[0], expected), vceqq_u8(metadata.val[1], vdupq_n_u8(tag)));
+
+        // Narrow to 4 bits per lane.
+        const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ULL;
+      }
+
+      static size_t lane(mask_t mask)
+      {
+        return etl::count_trailing_zeros(mask) / 4U;
+      }
+    };
+#elif ETL_USING_64BIT_TYPES && ((defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && defined(__ORDER_BIG_ENDIAN__)) || defined(_MSC_VER))
+    //*************************************************************************
+    /// SWAR (SIMD within a register) version, four slots at a time.
+    //*************************************************************************
+    struct group
+    {
+      typedef uint64_t mask_t;
+
+      static ETL_CONSTANT size_t Size = 4U;
+
+      static mask_t match(const slot_metadata* pmetadata, uint8_t distance, uint8_t tag)
+      {
+        // Loaded the same way as the metadata, so are independent of the endianness.
+        static const slot_metadata lane_offsets[4]  = { { 0U, 0U }, { 1U, 0U }, { 2U, 0U }, { 3U, 0U } };
+        static const slot_metadata distance_ones[4] = { { 1U, 0U }, { 1U, 0U }, { 1U, 0U }, { 1U, 0U } };
+        static const slot_metadata tag_ones[4]      = { { 0U, 1U }, { 0U, 1U }, { 0U, 1U }, { 0U, 1U } };
+
+        const uint64_t Low15 = 0x7FFF7FFF7FFF7FFFULL;
+
+        uint64_t metadata;
+        uint64_t offsets;
+        uint64_t distances;
+        uint64_t tags;
+
+        memcpy(&metadata,  pmetadata,     sizeof(metadata));
+        memcpy(&offsets,   lane_offsets,  sizeof(offsets));
+        memcpy(&distances, distance_ones, sizeof(distances));
+        memcpy(&tags,      tag_ones,      sizeof(tags));
+
+        // Zero 16 bit lanes are matches.
+        const uint64_t x = metadata ^ (offsets + (distances * distance) + (tags * tag));
+
+        // Exact zero lane detection; no false positives from borrows.
+        return ~(((x & Low15) + Low15) | x | Low15);
+      }
+
+      static size_t lane(mask_t mask)
+      {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        return 3U - (etl::count_trailing_zeros(mask) / 16U);
+#else
+        return etl::count_trailing_zeros(mask) / 16U;
+#endif
+      }
+    };
+#else
+    //*************************************************************************
+    /// Portable version, one slot at a time.
+    //*************************************************************************
+    struct group
+    {
+      typedef uint32_t mask_t;
+
+      static ETL_CONSTANT size_t Size = 1U;
+
+      static mask_t match(const slot_metadata* pmetadata, uint8_t distance, uint8_t tag)
+      {
+        return ((pmetadata->distance == distance) && (pmetadata->tag == tag)) ? 1U : 0U;
+      }
+
+      static size_t lane(mask_t)
+      {
+        return 0U;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Calculates the table dimensions for a fixed capacity.
+    /// Home slots are a power of 2, with a load factor of at most 0.8.
+    /// Probes never wrap. Overflow slots follow the home slots so that a
+    /// small table can always be filled to capacity.
+    /// The metadata arrays are padded so that a group may be read from any slot.
+    //*************************************************************************
+    template <size_t MAX_SIZE_>
+    struct table_size
+    {
+      static ETL_CONSTANT size_t Max_Overflow   = 256U - group::Size - 1U;
+      static ETL_CONSTANT size_t Home_Slots     = etl::power_of_2_round_up<MAX_SIZE_ + (MAX_SIZE_ / 4U)>::value;
+      static ETL_CONSTANT size_t Overflow_Slots = (MAX_SIZE_ < Max_Overflow) ? MAX_SIZE_ : Max_Overflow;
+      static ETL_CONSTANT size_t Slots          = Home_Slots + Overflow_Slots;
+      static ETL_CONSTANT size_t Metadata_Size  = Slots + group::Size;
+      static ETL_CONSTANT size_t Shift          = (sizeof(size_t) * CHAR_BIT) - etl::log2<Home_Slots>::value;
+    };
+
+    //*************************************************************************
+    /// Iterator for the flat hash containers.
+    /// Walks the slot array, skipping empty slots.
+    /// The metadata array has a non-zero sentinel at the end.
+    ///\tparam TValue   The stored value type.
+    ///\tparam TElement The type the iterator dereferences to.
+    //*************************************************************************
+    template <typename TValue, typename TElement>
+    class flat_hash_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TElement>
+    {
+    public:
+
+      typedef TElement& reference;
+      typedef TElement* pointer;
+
+      template <typename, typename>
+      friend class flat_hash_iterator;
+
+      //*********************************
+      flat_hash_iterator()
+        : pmetadata(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      flat_hash_iterator(const slot_metadata* pmetadata_, TValue* pslot_)
+        : pmetadata(pmetadata_)
+        , pslot(pslot_)
+      {
+      }
+
+      //*********************************
+      /// Allows conversion from a mutable iterator to a const iterator.
+      //*********************************
+      template <typename TOtherElement>
+      flat_hash_iterator(const flat_hash_iterator<TValue, TOtherElement>& other,
+                         typename etl::enable_if<etl::is_same<const TOtherElement, TElement>::value && !etl::is_same<TOtherElement, TElement>::value, int>::type = 0)
+        : pmetadata(other.pmetadata)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      flat_hash_iterator& operator ++()
+      {
+        do
+        {
+          ++pmetadata;
+          ++pslot;
+        } while (pmetadata->distance == 0U);
+
+        return *this;
+      }
+
+      //*********************************
+      flat_hash_iterator operator ++(int)
+      {
+        flat_hash_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator == (const flat_hash_iterator& lhs, const flat_hash_iterator& rhs)
+      {
+        return lhs.pslot == rhs.pslot;
+      }
+
+      //*********************************
+      friend bool operator != (const flat_hash_iterator& lhs, const flat_hash_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*********************************
+      /// The raw slot pointer.
+      //*********************************
+      TValue* get_slot() const
+      {
+        return pslot;
+      }
+
+    private:
+
+      const slot_metadata* pmetadata;
+      TValue*        pslot;
+    };
+
+    //*************************************************************************
+    /// The open addressing hash table engine shared by flat_hash_map and flat_hash_set.
+    /// Robin Hood linear probing with backward shift deletion, so there are no tombstones.
+    /// The per-slot metadata is a separate array holding the probe distance + 1,
+    /// with 0 meaning 'empty', and a tag taken from the hash bits below those that
+    /// select the home slot.
+    /// Lookups compare the metadata a group of slots at a time, and only call
+    /// key_equal for the slots where both the distance and the tag match.
+    ///\tparam TValue    The stored value type.
+    ///\tparam TKey      The key type.
+    ///\tparam TKeyOf    Functor that returns the key of a stored value.
+    ///\tparam THash     The hash functor.
+    ///\tparam TKeyEqual The key equality functor.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename THash, typename TKeyEqual>
+    class table
+    {
+    public:
+
+      typedef TValue    value_type;
+      typedef TKey      key_type;
+      typedef THash     hasher;
+      typedef TKeyEqual key_equal;
+      typedef size_t    size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      /// The largest probe distance that can be stored, plus 1.
+      /// A group must be able to compare distances up to Max_Distance + group::Size - 1,
+      /// so a probe stops before a group that starts beyond Max_Distance.
+      static ETL_CONSTANT uint8_t Max_Distance = static_cast<uint8_t>(256U - group::Size);
+
+      //*************************************************************************
+      /// The result of a reservation.
+      //*************************************************************************
+      enum reserve_status
+      {
+        Reserved, ///< A new empty slot has been made at the index.
+        Exists,   ///< The key already exists at the index.
+        Full      ///< There is no room for the key.
+      };
+
+      //*************************************************************************
+      /// Gets the size of the table.
+      //*************************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*************************************************************************
+      /// Gets the maximum possible size of the table.
+      //*************************************************************************
+      size_type max_size() const
+      {
+        return max_elements;
+      }
+
+      //*************************************************************************
+      /// Checks to see if the table is empty.
+      //*************************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*************************************************************************
+      /// Checks to see if the table is full.
+      //*************************************************************************
+      bool full() const
+      {
+        return current_size == max_elements;
+      }
+
+      //*************************************************************************
+      /// Returns the number of slots.
+      //*************************************************************************
+      size_type slot_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*************************************************************************
+      /// Returns the function that hashes the keys.
+      //*************************************************************************
+      hasher hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //*************************************************************************
+      /// Returns the function that compares the keys.
+      //*************************************************************************
+      key_equal key_eq() const
+      {
+        return key_equal_function;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      /// The metadata array must have number_of_slots_ + group::Size elements.
+      //*************************************************************************
+      table(TValue* pslots_, slot_metadata* pmetadata_, size_t number_of_slots_, size_t shift_, size_t max_elements_)
+        : pslots(pslots_)
+        , pmetadata(pmetadata_)
+        , number_of_slots(number_of_slots_)
+        , shift(shift_)
+        , tag_shift((shift_ > CHAR_BIT) ? shift_ - CHAR_BIT : 0U)
+        , max_elements(max_elements_)
+        , current_size(0U)
+      {
+        for (size_t i = 0U; i < (number_of_slots + group::Size); ++i)
+        {
+          pmetadata[i].distance = 0U;
+          pmetadata[i].tag      = 0U;
+        }
+
+        // The sentinel.
+        pmetadata[number_of_slots].distance = 1U;
+      }
+
+      //*************************************************************************
+      /// Gets the Fibonacci hash of a key.
+      //*************************************************************************
+      size_t mixed_hash(key_parameter_t key) const
+      {
+        return key_hash_function(key) * private_flat_hash::fibonacci_multiplier<>::value;
+      }
+
+      //*************************************************************************
+      /// Gets the home slot index from the mixed hash.
+      //*************************************************************************
+      size_t home_index(size_t hash) const
+      {
+        return hash >> shift;
+      }
+
+      //*************************************************************************
+      /// Gets the tag from the mixed hash.
+      //*************************************************************************
+      uint8_t tag_of(size_t hash) const
+      {
+        return static_cast<uint8_t>(hash >> tag_shift);
+      }
+
+      //*************************************************************************
+      /// Probes for a key, a group at a time.
+      /// In a Robin Hood table the difference between the stored and the expected
+      /// distance never increases along a probe, so if the last slot of a group
+      /// is closer to its home than the key would be, the key cannot be further on.
+      ///\param index    The start of the probe. Set to the start of the last group probed.
+      ///\param distance The distance at the start. Set to the distance at the start of the last group probed.
+      ///\return The index, or slot_count() if not found.
+      //*************************************************************************
+      size_t probe(key_parameter_t key, uint8_t tag, size_t& index, uint32_t& distance) const
+      {
+        while (true)
+        {
+          typename group::mask_t mask = group::match(pmetadata + index, static_cast<uint8_t>(distance), tag);
+
+          while (mask != 0U)
+          {
+            const size_t i = index + group::lane(mask);
+
+            if (key_equal_function(key, TKeyOf()(pslots[i])))
+            {
+              return i;
+            }
+
+            mask &= (mask - 1U);
+          }
+
+          if (pmetadata[index + group::Size - 1U].distance < (distance + group::Size - 1U))
+          {
+            return number_of_slots;
+          }
+
+          // No key is further than Max_Distance, and the next group's distances would overflow.
+          if ((distance + group::Size) > Max_Distance)
+          {
+            return number_of_slots;
+          }
+
+          index    += group::Size;
+          distance += group::Size;
+        }
+      }
+
+      //*************************************************************************
+      /// Finds the slot index of a key.
+      ///\return The index, or slot_count() if not found.
+      //*************************************************************************
+      size_t find_index(key_parameter_t key) const
+      {
+        const size_t hash = mixed_hash(key);
+        size_t   index    = home_index(hash);
+        uint32_t distance = 1U;
+
+        return probe(key, tag_of(hash), index, distance);
+      }
+
+      //*************************************************************************
+      /// Finds the key or makes an empty slot for it.
+      /// Elements after the slot are shifted up to the next empty slot.
+      /// If 'Reserved' is returned then the caller must construct a value at the index.
+      //*************************************************************************
+      reserve_status reserve_index(key_parameter_t key, size_t& index)
+      {
+        const size_t  hash = mixed_hash(key);
+        const uint8_t tag  = tag_of(hash);
+
+        index = home_index(hash);
+        uint32_t distance = 1U;
+
+        const size_t found = probe(key, tag, index, distance);
+
+        if (found != number_of_slots)
+        {
+          index = found;
+          return Exists;
+        }
+
+        // Skip the elements that are closer to their home.
+        while (pmetadata[index].distance >= distance)
+        {
+          ++index;
+          ++distance;
+        }
+
+        if (full() || (distance > Max_Distance) || (index == number_of_slots))
+        {
+          return Full;
+        }
+
+        // Find the next empty slot, checking that the shifted elements will fit.
+        size_t empty_index = index;
+
+        while (pmetadata[empty_index].distance != 0U)
+        {
+          if (pmetadata[empty_index].distance == Max_Distance)
+          {
+            return Full;
+          }
+
+          ++empty_index;
+        }
+
+        if (empty_index == number_of_slots)
+        {
+          return Full;
+        }
+
+        // Shift the elements up by one.
+        while (empty_index != index)
+        {
+          ::new (pslots + empty_index) TValue(ETL_MOVE(pslots[empty_index - 1U]));
+          pslots[empty_index - 1U].~TValue();
+          pmetadata[empty_index].distance = pmetadata[empty_index - 1U].distance + 1U;
+          pmetadata[empty_index].tag      = pmetadata[empty_index - 1U].tag;
+          --empty_index;
+        }
+
+        pmetadata[index].distance = static_cast<uint8_t>(distance);
+        pmetadata[index].tag      = tag;
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
+
+        return Reserved;
+      }
+
+      //*************************************************************************
+      /// Erases the element at the index.
+      /// Shifts back the following elements that are not in their home slot.
+      //*************************************************************************
+      void erase_index(size_t index)
+      {
+        pslots[index].~TValue();
+
+        while (pmetadata[index + 1U].distance > 1U)
+        {
+          ::new (pslots + index) TValue(ETL_MOVE(pslots[index + 1U]));
+          pslots[index + 1U].~TValue();
+          pmetadata[index].distance = pmetadata[index + 1U].distance - 1U;
+          pmetadata[index].tag      = pmetadata[index + 1U].tag;
+          ++index;
+        }
+
+        pmetadata[index].distance = 0U;
+        --current_size;
+        ETL_DECREMENT_DEBUG_COUNT
+      }
+
+      //*************************************************************************
+      /// Gets the index of the first occupied slot, or slot_count() if empty.
+      //*************************************************************************
+      size_t first_index() const
+      {
+        size_t index = 0U;
+
+        while (pmetadata[index].distance == 0U)
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      //*************************************************************************
+      /// Gets the index of the first occupied slot at or after the index.
+      //*************************************************************************
+      size_t next_occupied_index(size_t index) const
+      {
+        while (pmetadata[index].distance == 0U)
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      //*************************************************************************
+      /// Destroys all of the elements.
+      //*************************************************************************
+      void clear_all()
+      {
+        if (!empty())
+        {
+          for (size_t i = 0U; i < number_of_slots; ++i)
+          {
+            if (pmetadata[i].distance != 0U)
+            {
+              pslots[i].~TValue();
+              pmetadata[i].distance = 0U;
+              ETL_DECREMENT_DEBUG_COUNT
+            }
+          }
+
+          current_size = 0U;
+        }
+      }
+
+      //*************************************************************************
+      /// Gets the slot index of a slot pointer.
+      //*************************************************************************
+      size_t index_of(const TValue* pslot) const
+      {
+        return static_cast<size_t>(pslot - pslots);
+      }
+
+      /// The array of slots.
+      TValue* pslots;
+
+      /// The metadata of each slot.
+      slot_metadata* pmetadata;
+
+      /// The number of slots.
+      const size_t number_of_slots;
+
+      /// The right shift applied to the Fibonacci hash to get the home slot.
+      const size_t shift;
+
+      /// The right shift applied to the Fibonacci hash to get the tag.
+      const size_t tag_shift;
+
+      /// The maximum number of elements.
+      const size_t max_elements;
+
+      /// The current number of elements.
+      size_t current_size;
+
+      /// The function that creates the hashes.
+      hasher key_hash_function;
+
+      /// The function that compares the keys for equality.
+      key_equal key_equal_function;
+
+      /// For library debugging purposes only.
+      ETL_DECLARE_DEBUG_COUNT
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+      ~table()
+      {
+      }
+
+    private:
+
+      // Disable copy construction.
+      table(const table&);
+    };
+  }
+}
+
+#endif
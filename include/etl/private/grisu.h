@@ -0,0 +1,483 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_GRISU_INCLUDED
+#define ETL_GRISU_INCLUDED
+
+///\ingroup private
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../static_assert.h"
+#include "../binary.h"
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_grisu
+  {
+    //*************************************************************************
+    /// The layout of the IEEE-754 types.
+    //*************************************************************************
+    template <typename T>
+    struct float_traits;
+
+    template <>
+    struct float_traits<float>
+    {
+      typedef uint32_t bits_type;
+
+      static ETL_CONSTANT int Precision = 24; // Including the hidden bit.
+      static ETL_CONSTANT int Bias      = 127 + (Precision - 1);
+
+      static ETL_CONSTANT int Max_Digits10 = 9;
+    };
+
+    template <>
+    struct float_traits<double>
+    {
+      typedef uint64_t bits_type;
+
+      static ETL_CONSTANT int Precision = 53; // Including the hidden bit.
+      static ETL_CONSTANT int Bias      = 1023 + (Precision - 1);
+
+      static ETL_CONSTANT int Max_Digits10 = 17;
+    };
+
+    //*************************************************************************
+    /// A floating point value with a 64 bit significand, f * 2^e.
+    //*************************************************************************
+    struct diy_fp
+    {
+      diy_fp(uint64_t f_, int e_)
+        : f(f_)
+        , e(e_)
+      {
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //*************************************************************************
+    /// x - y, where x and y have the same exponent and x >= y.
+    //*************************************************************************
+    inline diy_fp subtract(const diy_fp& x, const diy_fp& y)
+    {
+      return diy_fp(x.f - y.f, x.e);
+    }
+
+    //*************************************************************************
+    /// The upper 64 bits of the 128 bit product, rounded.
+    //*************************************************************************
+    inline diy_fp multiply(const diy_fp& x, const diy_fp& y)
+    {
+      const uint64_t x_lo = x.f & 0xFFFFFFFFU;
+      const uint64_t x_hi = x.f >> 32U;
+      const uint64_t y_lo = y.f & 0xFFFFFFFFU;
+      const uint64_t y_hi = y.f >> 32U;
+
+      const uint64_t p0 = x_lo * y_lo;
+      const uint64_t p1 = x_lo * y_hi;
+      const uint64_t p2 = x_hi * y_lo;
+      const uint64_t p3 = x_hi * y_hi;
+
+      uint64_t q = (p0 >> 32U) + (p1 & 0xFFFFFFFFU) + (p2 & 0xFFFFFFFFU);
+      q += uint64_t(1U) << 31U; // Round.
+
+      return diy_fp(p3 + (p1 >> 32U) + (p2 >> 32U) + (q >> 32U), x.e + y.e + 64);
+    }
+
+    //*************************************************************************
+    /// Shifts a non-zero significand until the top bit is set.
+    //*************************************************************************
+    inline diy_fp normalise(diy_fp x)
+    {
+      const int shift = etl::count_leading_zeros(x.f);
+
+      return diy_fp(x.f << shift, x.e - shift);
+    }
+
+    //*************************************************************************
+    /// The value and the two boundaries half way to its neighbours.
+    /// The upper boundary is normalised and the lower has the same exponent.
+    //*************************************************************************
+    struct boundaries
+    {
+      boundaries(const diy_fp& minus_, const diy_fp& plus_)
+        : minus(minus_)
+        , plus(plus_)
+      {
+      }
+
+      diy_fp minus;
+      diy_fp plus;
+    };
+
+    //*************************************************************************
+    /// Splits a finite, positive value into its significand and exponent.
+    //*************************************************************************
+    template <typename T>
+    diy_fp decompose(T value, bool& lower_boundary_is_closer)
+    {
+      typedef float_traits<T>                  traits;
+      typedef typename traits::bits_type       bits_type;
+
+      ETL_STATIC_ASSERT(sizeof(T) == sizeof(bits_type), "Unexpected floating point size");
+
+      const bits_type hidden_bit = bits_type(1U) << (traits::Precision - 1);
+      const int       min_exp    = 1 - traits::Bias;
+
+      bits_type bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      const bits_type exponent    = bits >> (traits::Precision - 1);
+      const bits_type significand = bits & (hidden_bit - 1U);
+
+      // The gap below a power of two is half the gap above it.
+      lower_boundary_is_closer = (significand == 0U) && (exponent > 1U);
+
+      if (exponent == 0U)
+      {
+        // Subnormal.
+        return diy_fp(significand, min_exp);
+      }
+      else
+      {
+        return diy_fp(significand + hidden_bit, int(exponent) - traits::Bias);
+      }
+    }
+
+    //*************************************************************************
+    template <typename T>
+    boundaries compute_boundaries(const diy_fp& v, bool lower_boundary_is_closer)
+    {
+      const diy_fp plus  = normalise(diy_fp((v.f * 2U) + 1U, v.e - 1));
+      const diy_fp minus = lower_boundary_is_closer ? diy_fp((v.f * 4U) - 1U, v.e - 2)
+                                                    : diy_fp((v.f * 2U) - 1U, v.e - 1);
+
+      return boundaries(diy_fp(minus.f << (minus.e - plus.e), plus.e), plus);
+    }
+
+    //*************************************************************************
+    /// A normalised power of ten, f * 2^e ~= 10^k.
+    //*************************************************************************
+    struct cached_power
+    {
+      uint64_t f;
+      int      e;
+      int      k;
+    };
+
+    //*************************************************************************
+    /// Finds a power of ten, c = 10^-k, so that the exponent of c * w is in
+    /// the range [Alpha, Gamma] for a value w with binary exponent 'e'.
+    /// The table holds every eighth power from 10^-300 to 10^340.
+    //*************************************************************************
+    static ETL_CONSTANT int Alpha = -60;
+    static ETL_CONSTANT int Gamma = -32;
+
+    inline cached_power get_cached_power(int e)
+    {
+      static const cached_power powers[] =
+      {
+          { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+          { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+          { 0xBE5691EF416BD60CULL, -1007, -284 },
+          { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+          { 0xD3515C2831559A83ULL,  -954, -268 },
+          { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+          { 0xEA9C227723EE8BCBULL,  -901, -252 },
+          { 0xAECC49914078536DULL,  -874, -244 },
+          { 0x823C12795DB6CE57ULL,  -847, -236 },
+          { 0xC21094364DFB5637ULL,  -821, -228 },
+          { 0x9096EA6F3848984FULL,  -794, -220 },
+          { 0xD77485CB25823AC7ULL,  -768, -212 },
+          { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+          { 0xEF340A98172AACE5ULL,  -715, -196 },
+          { 0xB23867FB2A35B28EULL,  -688, -188 },
+          { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+          { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+          { 0x936B9FCEBB25C996ULL,  -608, -164 },
+          { 0xDBAC6C247D62A584ULL,  -582, -156 },
+          { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+          { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+          { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+          { 0x87625F056C7C4A8BULL,  -475, -124 },
+          { 0xC9BCFF6034C13053ULL,  -449, -116 },
+          { 0x964E858C91BA2655ULL,  -422, -108 },
+          { 0xDFF9772470297EBDULL,  -396, -100 },
+          { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+          { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+          { 0xB94470938FA89BCFULL,  -316,  -76 },
+          { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+          { 0xCDB02555653131B6ULL,  -263,  -60 },
+          { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+          { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+          { 0xAA242499697392D3ULL,  -183,  -36 },
+          { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+          { 0xBCE5086492111AEBULL,  -130,  -20 },
+          { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+          { 0xD1B71758E219652CULL,   -77,   -4 },
+          { 0x9C40000000000000ULL,   -50,    4 },
+          { 0xE8D4A51000000000ULL,   -24,   12 },
+          { 0xAD78EBC5AC620000ULL,     3,   20 },
+          { 0x813F3978F8940984ULL,    30,   28 },
+          { 0xC097CE7BC90715B3ULL,    56,   36 },
+          { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+          { 0xD5D238A4ABE98068ULL,   109,   52 },
+          { 0x9F4F2726179A2245ULL,   136,   60 },
+          { 0xED63A231D4C4FB27ULL,   162,   68 },
+          { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+          { 0x83C7088E1AAB65DBULL,   216,   84 },
+          { 0xC45D1DF942711D9AULL,   242,   92 },
+          { 0x924D692CA61BE758ULL,   269,  100 },
+          { 0xDA01EE641A708DEAULL,   295,  108 },
+          { 0xA26DA3999AEF774AULL,   322,  116 },
+          { 0xF209787BB47D6B85ULL,   348,  124 },
+          { 0xB454E4A179DD1877ULL,   375,  132 },
+          { 0x865B86925B9BC5C2ULL,   402,  140 },
+          { 0xC83553C5C8965D3DULL,   428,  148 },
+          { 0x952AB45CFA97A0B3ULL,   455,  156 },
+          { 0xDE469FBD99A05FE3ULL,   481,  164 },
+          { 0xA59BC234DB398C25ULL,   508,  172 },
+          { 0xF6C69A72A3989F5CULL,   534,  180 },
+          { 0xB7DCBF5354E9BECEULL,   561,  188 },
+          { 0x88FCF317F22241E2ULL,   588,  196 },
+          { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+          { 0x98165AF37B2153DFULL,   641,  212 },
+          { 0xE2A0B5DC971F303AULL,   667,  220 },
+          { 0xA8D9D1535CE3B396ULL,   694,  228 },
+          { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+          { 0xBB764C4CA7A44410ULL,   747,  244 },
+          { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+          { 0xD01FEF10A657842CULL,   800,  260 },
+          { 0x9B10A4E5E9913129ULL,   827,  268 },
+          { 0xE7109BFBA19C0C9DULL,   853,  276 },
+          { 0xAC2820D9623BF429ULL,   880,  284 },
+          { 0x80444B5E7AA7CF85ULL,   907,  292 },
+          { 0xBF21E44003ACDD2DULL,   933,  300 },
+          { 0x8E679C2F5E44FF8FULL,   960,  308 },
+          { 0xD433179D9C8CB841ULL,   986,  316 },
+          { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+          { 0xEB96BF6EBADF77D9ULL,  1039,  332 },
+          { 0xAF87023B9BF0EE6BULL,  1066,  340 }      };
+
+      static ETL_CONSTANT int Min_Decimal_Exponent = -300;
+      static ETL_CONSTANT int Decimal_Step         = 8;
+
+      // k = ceil((Alpha - e - 1) * log10(2)), using 78913 / 2^18 ~= log10(2).
+      const int f = Alpha - e - 1;
+      const int k = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+
+      const int index = (-Min_Decimal_Exponent + k + (Decimal_Step - 1)) / Decimal_Step;
+
+      return powers[index];
+    }
+
+    //*************************************************************************
+    /// The powers of ten that fit in 32 bits.
+    //*************************************************************************
+    inline const uint32_t* powers_of_ten()
+    {
+      static const uint32_t powers[] = { 1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U };
+
+      return powers;
+    }
+
+    //*************************************************************************
+    /// The number of decimal digits in 'n'.
+    //*************************************************************************
+    inline int count_digits(uint32_t n)
+    {
+      if (n < 10000U)
+      {
+        return (n < 100U) ? ((n < 10U) ? 1 : 2) : ((n < 1000U) ? 3 : 4);
+      }
+      else if (n < 100000000U)
+      {
+        return (n < 1000000U) ? ((n < 100000U) ? 5 : 6) : ((n < 10000000U) ? 7 : 8);
+      }
+      else
+      {
+        return (n < 1000000000U) ? 9 : 10;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes and returns the leading digit of an 'n' digit value.
+    /// The divisors are constants, so that the compiler can avoid a division.
+    //*************************************************************************
+    inline uint32_t take_leading_digit(uint32_t& value, int n)
+    {
+      uint32_t digit;
+
+      switch (n)
+      {
+        case 10: digit = value / 1000000000U; value %= 1000000000U; break;
+        case 9:  digit = value / 100000000U;  value %= 100000000U;  break;
+        case 8:  digit = value / 10000000U;   value %= 10000000U;   break;
+        case 7:  digit = value / 1000000U;    value %= 1000000U;    break;
+        case 6:  digit = value / 100000U;     value %= 100000U;     break;
+        case 5:  digit = value / 10000U;      value %= 10000U;      break;
+        case 4:  digit = value / 1000U;       value %= 1000U;       break;
+        case 3:  digit = value / 100U;        value %= 100U;        break;
+        case 2:  digit = value / 10U;         value %= 10U;         break;
+        default: digit = value;               value = 0U;           break;
+      }
+
+      return digit;
+    }
+
+    //*************************************************************************
+    /// Moves the last digit towards the value while it stays in range.
+    //*************************************************************************
+    inline void round_weed(char* buffer, int length, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t ten_k)
+    {
+      while ((rest < distance) &&
+             ((delta - rest) >= ten_k) &&
+             (((rest + ten_k) < distance) || ((distance - rest) > (rest + ten_k - distance))))
+      {
+        --buffer[length - 1];
+        rest += ten_k;
+      }
+    }
+
+    //*************************************************************************
+    /// Generates the digits of w, stopping as soon as the digits are inside
+    /// the range (M_minus, M_plus).
+    //*************************************************************************
+    inline void generate_digits(char* buffer, int& length, int& exponent, const diy_fp& M_minus, const diy_fp& w, const diy_fp& M_plus)
+    {
+      diy_fp delta    = subtract(M_plus, M_minus);
+      diy_fp distance = subtract(M_plus, w);
+
+      const diy_fp one(uint64_t(1U) << -M_plus.e, M_plus.e);
+
+      uint32_t p1 = uint32_t(M_plus.f >> -one.e);
+      uint64_t p2 = M_plus.f & (one.f - 1U);
+
+      // The integral part.
+      int n = count_digits(p1);
+
+      while (n > 0)
+      {
+        buffer[length++] = char('0' + take_leading_digit(p1, n));
+        --n;
+
+        const uint64_t rest = (uint64_t(p1) << -one.e) + p2;
+
+        if (rest <= delta.f)
+        {
+          exponent += n;
+          round_weed(buffer, length, distance.f, delta.f, rest, uint64_t(powers_of_ten()[n]) << -one.e);
+          return;
+        }
+      }
+
+      // The fractional part.
+      int m = 0;
+
+      while (true)
+      {
+        p2 *= 10U;
+
+        buffer[length++] = char('0' + (p2 >> -one.e));
+        p2 &= (one.f - 1U);
+        ++m;
+
+        delta.f    *= 10U;
+        distance.f *= 10U;
+
+        if (p2 <= delta.f)
+        {
+          break;
+        }
+      }
+
+      exponent -= m;
+      round_weed(buffer, length, distance.f, delta.f, p2, one.f);
+    }
+
+    //*************************************************************************
+    /// The maximum number of digits written by shortest_digits.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Max_Digits = 17U;
+
+    //*************************************************************************
+    /// Converts a finite, positive float or double to the shortest decimal
+    /// digits, value = digits * 10^exponent, that read back to the same value.
+    /// Uses Grisu2, which almost always finds the shortest digits, and
+    /// otherwise finds ones that are one digit longer but still round trip.
+    /// The digits are not terminated. Returns the number of digits.
+    /// Zero returns the single digit '0'.
+    //*************************************************************************
+    template <typename T>
+    int shortest_digits(T value, char* buffer, int& exponent)
+    {
+      exponent = 0;
+
+      if (value == T(0))
+      {
+        buffer[0] = '0';
+        return 1;
+      }
+
+      bool lower_boundary_is_closer;
+      const diy_fp     v = decompose(value, lower_boundary_is_closer);
+      const boundaries b = compute_boundaries<T>(v, lower_boundary_is_closer);
+
+      const cached_power cached = get_cached_power(b.plus.e);
+      const diy_fp       c(cached.f, cached.e);
+
+      const diy_fp w       = multiply(normalise(v), c);
+      const diy_fp w_minus = multiply(b.minus, c);
+      const diy_fp w_plus  = multiply(b.plus, c);
+
+      // Allow for the error in the products.
+      const diy_fp M_minus(w_minus.f + 1U, w_minus.e);
+      const diy_fp M_plus(w_plus.f - 1U, w_plus.e);
+
+      int length = 0;
+      exponent = -cached.k;
+
+      generate_digits(buffer, length, exponent, M_minus, w, M_plus);
+
+      return length;
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,61 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IS_CONTIGUOUS_ITERATOR_INCLUDED
+#define ETL_IS_CONTIGUOUS_ITERATOR_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../iterator.h"
+
+namespace etl
+{
+  namespace private_iterator
+  {
+    //***************************************************************************
+    /// Checks whether an iterator addresses contiguous memory.
+    /// Pointers always do. Other iterators are recognised when the
+    /// standard library has contiguous_iterator.
+    //***************************************************************************
+    template <typename TIterator>
+    struct is_contiguous_iterator
+    {
+#if ETL_USING_STL && defined(__cpp_lib_concepts)
+      static ETL_CONSTANT bool value = std::contiguous_iterator<TIterator>;
+#else
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value;
+#endif
+    };
+  }
+}
+
+#endif
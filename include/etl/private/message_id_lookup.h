@@ -0,0 +1,219 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_ID_LOOKUP_INCLUDED
+#define ETL_MESSAGE_ID_LOOKUP_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../message_types.h"
+#include "../type_traits.h"
+
+#if ETL_CPP17_SUPPORTED
+
+namespace etl
+{
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// A compile time map from a message id to the index of its message type
+    /// in a type list.
+    /// If the ids span no more than Max_Dense_Range values, the map is a table
+    /// indexed by the id, and find() is O(1). Otherwise the ids are sorted and
+    /// find() is a binary search.
+    /// If more than one type has the same id, the first one is found.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    class message_id_lookup
+    {
+    public:
+
+      static constexpr size_t Number_Of_Types = sizeof...(TMessageTypes);
+
+      /// Returned by find() for an id that is not in the list.
+      static constexpr size_t npos = Number_Of_Types;
+
+    private:
+
+      typedef typename etl::conditional<(Number_Of_Types < 255U), uint_least8_t, uint_least16_t>::type index_type;
+
+      //*******************************
+      struct id_table
+      {
+        etl::message_id_t id[Number_Of_Types];
+        index_type        index[Number_Of_Types];
+      };
+
+      //*******************************
+      // The ids, sorted, with their type indexes.
+      // An insertion sort keeps types with equal ids in their original order.
+      //*******************************
+      static constexpr id_table make_sorted_table()
+      {
+        id_table table = { { etl::message_id_t(TMessageTypes::ID)... }, {} };
+
+        for (size_t i = 0U; i < Number_Of_Types; ++i)
+        {
+          table.index[i] = index_type(i);
+        }
+
+        for (size_t i = 1U; i < Number_Of_Types; ++i)
+        {
+          const etl::message_id_t id    = table.id[i];
+          const index_type        index = table.index[i];
+
+          size_t j = i;
+
+          while ((j > 0U) && (id < table.id[j - 1U]))
+          {
+            table.id[j]    = table.id[j - 1U];
+            table.index[j] = table.index[j - 1U];
+            --j;
+          }
+
+          table.id[j]    = id;
+          table.index[j] = index;
+        }
+
+        return table;
+      }
+
+      static constexpr id_table Sorted = make_sorted_table();
+
+      static constexpr etl::message_id_t Min_Id = Sorted.id[0];
+      static constexpr etl::message_id_t Max_Id = Sorted.id[Number_Of_Types - 1U];
+
+    public:
+
+      /// The number of ids between the smallest and largest, inclusive.
+      static constexpr size_t Range = size_t(uintmax_t(Max_Id) - uintmax_t(Min_Id)) + 1U;
+
+      /// The largest range that uses a table indexed by id.
+      static constexpr size_t Max_Dense_Range = 64U + (4U * Number_Of_Types);
+
+      static constexpr bool Is_Dense = (Range <= Max_Dense_Range);
+
+    private:
+
+      //*******************************
+      struct dense_table
+      {
+        index_type index[Is_Dense ? Range : 1U];
+      };
+
+      //*******************************
+      static constexpr dense_table make_dense_table()
+      {
+        dense_table table = {};
+
+        for (size_t i = 0U; i < (Is_Dense ? Range : 1U); ++i)
+        {
+          table.index[i] = index_type(npos);
+        }
+
+        if constexpr (Is_Dense)
+        {
+          // Backwards, so that the first type with an id wins.
+          for (size_t i = Number_Of_Types; i > 0U; --i)
+          {
+            table.index[size_t(Sorted.id[i - 1U]) - size_t(Min_Id)] = Sorted.index[i - 1U];
+          }
+        }
+
+        return table;
+      }
+
+      static constexpr dense_table Dense = make_dense_table();
+
+    public:
+
+      //*******************************
+      /// Returns the index of the type with the id, or npos.
+      //*******************************
+      static constexpr size_t find(etl::message_id_t id)
+      {
+        if constexpr (Is_Dense)
+        {
+          const size_t offset = size_t(id) - size_t(Min_Id);
+
+          return (offset < Range) ? size_t(Dense.index[offset]) : npos;
+        }
+        else
+        {
+          // Find the first id that is not less than 'id'.
+          size_t first = 0U;
+          size_t count = Number_Of_Types;
+
+          while (count > 0U)
+          {
+            const size_t step = count / 2U;
+
+            if (Sorted.id[first + step] < id)
+            {
+              first += step + 1U;
+              count -= step + 1U;
+            }
+            else
+            {
+              count = step;
+            }
+          }
+
+          return ((first < Number_Of_Types) && (Sorted.id[first] == id)) ? size_t(Sorted.index[first]) : npos;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Specialisation for no message types.
+    //*************************************************************************
+    template <>
+    class message_id_lookup<>
+    {
+    public:
+
+      static constexpr size_t Number_Of_Types = 0U;
+      static constexpr size_t npos            = 0U;
+
+      //*******************************
+      static constexpr size_t find(etl::message_id_t)
+      {
+        return npos;
+      }
+    };
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,638 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../binary.h"
+
+#if ETL_USING_SSE2
+  #include <emmintrin.h>
+#elif ETL_USING_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Single byte characters can use memchr and compare a block at a time.
+    //*************************************************************************
+    template <typename T>
+    struct is_byte : etl::integral_constant<bool, etl::is_integral<T>::value && (sizeof(T) == 1U)>
+    {
+    };
+
+#if ETL_USING_SSE2
+    //*************************************************************************
+    /// Compares 16 bytes in one step, returning a mask with a set bit for
+    /// each byte that matches.
+    //*************************************************************************
+    struct block
+    {
+      typedef uint32_t mask_t;
+
+      static ETL_CONSTANT size_t Size      = 16U;
+      static ETL_CONSTANT mask_t All_Lanes = 0xFFFFU;
+
+      //*******************************
+      /// The bytes at 'p' equal to 'c'.
+      //*******************************
+      static mask_t match(const void* p, uint8_t c)
+      {
+        const __m128i bytes = _mm_loadu_si128(static_cast<const __m128i*>(p));
+
+        return static_cast<mask_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(c)))));
+      }
+
+      //*******************************
+      /// The lanes where the bytes at 'p1' equal 'c1' and the bytes at 'p2' equal 'c2'.
+      //*******************************
+      static mask_t match(const void* p1, uint8_t c1, const void* p2, uint8_t c2)
+      {
+        const __m128i bytes1 = _mm_loadu_si128(static_cast<const __m128i*>(p1));
+        const __m128i bytes2 = _mm_loadu_si128(static_cast<const __m128i*>(p2));
+
+        const __m128i matches = _mm_and_si128(_mm_cmpeq_epi8(bytes1, _mm_set1_epi8(static_cast<char>(c1))),
+                                              _mm_cmpeq_epi8(bytes2, _mm_set1_epi8(static_cast<char>(c2))));
+
+        return static_cast<mask_t>(_mm_movemask_epi8(matches));
+      }
+
+      //*******************************
+      /// The bytes at 'p' equal to any of the 'n' at 's'.
+      //*******************************
+      static mask_t match_any(const void* p, const void* s, size_t n)
+      {
+        const __m128i  bytes   = _mm_loadu_si128(static_cast<const __m128i*>(p));
+        const uint8_t* set     = static_cast<const uint8_t*>(s);
+        __m128i        matches = _mm_setzero_si128();
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(set[i]))));
+        }
+
+        return static_cast<mask_t>(_mm_movemask_epi8(matches));
+      }
+
+      //*******************************
+      /// The lanes where the bytes at 'p1' and 'p2' differ.
+      //*******************************
+      static mask_t mismatch(const void* p1, const void* p2)
+      {
+        const __m128i bytes1 = _mm_loadu_si128(static_cast<const __m128i*>(p1));
+        const __m128i bytes2 = _mm_loadu_si128(static_cast<const __m128i*>(p2));
+
+        return static_cast<mask_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes1, bytes2))) ^ All_Lanes;
+      }
+
+      //*******************************
+      static size_t first_lane(mask_t mask)
+      {
+        return etl::count_trailing_zeros(mask);
+      }
+
+      //*******************************
+      static size_t last_lane(mask_t mask)
+      {
+        return 31U - etl::count_leading_zeros(mask);
+      }
+    };
+#elif ETL_USING_NEON
+    //*************************************************************************
+    /// Compares 16 bytes in one step, returning a mask with a set bit for
+    /// each byte that matches.
+    /// NEON has no movemask, so the mask has one bit in each 4 bit lane.
+    //*************************************************************************
+    struct block
+    {
+      typedef uint64_t mask_t;
+
+      static ETL_CONSTANT size_t Size      = 16U;
+      static ETL_CONSTANT mask_t All_Lanes = 0x8888888888888888ULL;
+
+      //*******************************
+      /// The bytes at 'p' equal to 'c'.
+      //*******************************
+      static mask_t match(const void* p, uint8_t c)
+      {
+        return to_mask(vceqq_u8(vld1q_u8(static_cast<const uint8_t*>(p)), vdupq_n_u8(c)));
+      }
+
+      //*******************************
+      /// The lanes where the bytes at 'p1' equal 'c1' and the bytes at 'p2' equal 'c2'.
+      //*******************************
+      static mask_t match(const void* p1, uint8_t c1, const void* p2, uint8_t c2)
+      {
+        return to_mask(vandq_u8(vceqq_u8(vld1q_u8(static_cast<const uint8_t*>(p1)), vdupq_n_u8(c1)),
+                                vceqq_u8(vld1q_u8(static_cast<const uint8_t*>(p2)), vdupq_n_u8(c2))));
+      }
+
+      //*******************************
+      /// The bytes at 'p' equal to any of the 'n' at 's'.
+      //*******************************
+      static mask_t match_any(const void* p, const void* s, size_t n)
+      {
+        const uint8x16_t bytes   = vld1q_u8(static_cast<const uint8_t*>(p));
+        const uint8_t*   set     = static_cast<const uint8_t*>(s);
+        uint8x16_t       matches = vdupq_n_u8(0U);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          matches = vorrq_u8(matches, vceqq_u8(bytes, vdupq_n_u8(set[i])));
+        }
+
+        return to_mask(matches);
+      }
+
+      //*******************************
+      /// The lanes where the bytes at 'p1' and 'p2' differ.
+      //*******************************
+      static mask_t mismatch(const void* p1, const void* p2)
+      {
+        return to_mask(vmvnq_u8(vceqq_u8(vld1q_u8(static_cast<const uint8_t*>(p1)), vld1q_u8(static_cast<const uint8_t*>(p2)))));
+      }
+
+      //*******************************
+      static size_t first_lane(mask_t mask)
+      {
+        return etl::count_trailing_zeros(mask) / 4U;
+      }
+
+      //*******************************
+      static size_t last_lane(mask_t mask)
+      {
+        return (63U - etl::count_leading_zeros(mask)) / 4U;
+      }
+
+    private:
+
+      //*******************************
+      static mask_t to_mask(uint8x16_t matches)
+      {
+        const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & All_Lanes;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// The first 'c' in [first, last), or last.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<!is_byte<T>::value, const T*>::type
+      find_char(const T* first, const T* last, T c)
+    {
+      while ((first != last) && !(*first == c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// The first 'c' in [first, last), or last.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<is_byte<T>::value, const T*>::type
+      find_char(const T* first, const T* last, T c)
+    {
+      if (first == last)
+      {
+        return last;
+      }
+
+      const void* p = memchr(first, static_cast<unsigned char>(c), size_t(last - first));
+
+      return (p == ETL_NULLPTR) ? last : static_cast<const T*>(p);
+    }
+
+    //*************************************************************************
+    /// The last 'c' in [first, last), or last.
+    //*************************************************************************
+    template <typename T>
+    const T* rfind_char(const T* first, const T* last, T c)
+    {
+      const T* p = last;
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value)
+      {
+        while (size_t(p - first) >= block::Size)
+        {
+          p -= block::Size;
+
+          const block::mask_t mask = block::match(p, static_cast<uint8_t>(c));
+
+          if (mask != 0U)
+          {
+            return p + block::last_lane(mask);
+          }
+        }
+      }
+#endif
+
+      while (p != first)
+      {
+        --p;
+
+        if (*p == c)
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// The index of the first difference between the 'n' characters at
+    /// 'p1' and 'p2', or 'n' if they are the same.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch(const T* p1, const T* p2, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value)
+      {
+        for (; (n - i) >= block::Size; i += block::Size)
+        {
+          const block::mask_t mask = block::mismatch(p1 + i, p2 + i);
+
+          if (mask != 0U)
+          {
+            return i + block::first_lane(mask);
+          }
+        }
+      }
+#endif
+
+      while ((i != n) && (p1[i] == p2[i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The first of the 'n' characters at 's' in [first, last), or last.
+    /// For bytes, blocks of candidate positions are selected by comparing
+    /// their first and last characters, and only those are compared in full.
+    /// Otherwise the candidates are the occurrences of the first character.
+    //*************************************************************************
+    template <typename T>
+    const T* search(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 0U)
+      {
+        return first;
+      }
+
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      if (n == 1U)
+      {
+        return find_char(first, last, *s);
+      }
+
+      // One past the last position that the search string could start at.
+      const T* const end = last - n + 1U;
+      const T*       p   = first;
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value)
+      {
+        while (size_t(end - p) >= block::Size)
+        {
+          block::mask_t mask = block::match(p, static_cast<uint8_t>(s[0]), p + n - 1U, static_cast<uint8_t>(s[n - 1U]));
+
+          while (mask != 0U)
+          {
+            const T* candidate = p + block::first_lane(mask);
+
+            if (mismatch(candidate + 1U, s + 1U, n - 2U) == (n - 2U))
+            {
+              return candidate;
+            }
+
+            mask &= (mask - 1U);
+          }
+
+          p += block::Size;
+        }
+      }
+#endif
+
+      while ((p = find_char(p, end, s[0])) != end)
+      {
+        if (mismatch(p + 1U, s + 1U, n - 1U) == (n - 1U))
+        {
+          return p;
+        }
+
+        ++p;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// A set of characters, for the find_*_of family.
+    /// Characters below 256 are looked up in a bitmap, so a search is O(n)
+    /// rather than O(n * m). Wider characters fall back to a linear search
+    /// of the characters, but only if there are some in the set.
+    //*************************************************************************
+    template <typename T>
+    class character_set
+    {
+    public:
+
+      //*******************************
+      character_set(const T* s, size_t n)
+        : p_characters(s)
+        , n_characters(n)
+        , has_wide(false)
+      {
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          bits[i] = 0U;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const unsigned_t u = unsigned_t(s[i]);
+
+          if ((u >> 8U) == 0U)
+          {
+            bits[u >> 5U] |= uint32_t(1U) << (u & 31U);
+          }
+          else
+          {
+            has_wide = true;
+          }
+        }
+      }
+
+      //*******************************
+      bool contains(T c) const
+      {
+        const unsigned_t u = unsigned_t(c);
+
+        if ((u >> 8U) == 0U)
+        {
+          return (bits[u >> 5U] & (uint32_t(1U) << (u & 31U))) != 0U;
+        }
+
+        return has_wide && (find_char(p_characters, p_characters + n_characters, c) != (p_characters + n_characters));
+      }
+
+    private:
+
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      uint32_t bits[8];
+      const T* p_characters;
+      size_t   n_characters;
+      bool     has_wide;
+    };
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+    //*************************************************************************
+    /// Sets of bytes up to this size are compared with a block at a time.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Max_Block_Set = 16U;
+
+    //*************************************************************************
+    /// Advances 'first' a block at a time to the first byte that is in the set,
+    /// or not in the set if 'invert' is block::All_Lanes.
+    /// Returns the byte, or ETL_NULLPTR if there is none in the whole blocks.
+    //*************************************************************************
+    template <typename T>
+    const T* first_of_blocks(const T*& first, const T* last, const T* s, size_t n, block::mask_t invert)
+    {
+      for (; size_t(last - first) >= block::Size; first += block::Size)
+      {
+        const block::mask_t mask = block::match_any(first, s, n) ^ invert;
+
+        if (mask != 0U)
+        {
+          return first + block::first_lane(mask);
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Moves 'last' back a block at a time to the last byte that is in the set,
+    /// or not in the set if 'invert' is block::All_Lanes.
+    /// Returns the byte, or ETL_NULLPTR if there is none in the whole blocks.
+    //*************************************************************************
+    template <typename T>
+    const T* last_of_blocks(const T* first, const T*& last, const T* s, size_t n, block::mask_t invert)
+    {
+      while (size_t(last - first) >= block::Size)
+      {
+        last -= block::Size;
+
+        const block::mask_t mask = block::match_any(last, s, n) ^ invert;
+
+        if (mask != 0U)
+        {
+          return last + block::last_lane(mask);
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+#endif
+
+    //*************************************************************************
+    /// The first character in [first, last) that is one of the 'n' at 's', or last.
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_of(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 1U)
+      {
+        return find_char(first, last, *s);
+      }
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value && (n <= Max_Block_Set))
+      {
+        const T* p = first_of_blocks(first, last, s, n, 0U);
+
+        if (p != ETL_NULLPTR)
+        {
+          return p;
+        }
+      }
+#endif
+
+      const character_set<T> set(s, n);
+
+      while ((first != last) && !set.contains(*first))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// The last character in [first, last) that is one of the 'n' at 's', or last.
+    //*************************************************************************
+    template <typename T>
+    const T* find_last_of(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 1U)
+      {
+        return rfind_char(first, last, *s);
+      }
+
+      const T* end = last;
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value && (n <= Max_Block_Set))
+      {
+        const T* p = last_of_blocks(first, end, s, n, 0U);
+
+        if (p != ETL_NULLPTR)
+        {
+          return p;
+        }
+      }
+#endif
+
+      const character_set<T> set(s, n);
+
+      const T* p = end;
+
+      while (p != first)
+      {
+        --p;
+
+        if (set.contains(*p))
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// The first character in [first, last) that is not one of the 'n' at 's', or last.
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_not_of(const T* first, const T* last, const T* s, size_t n)
+    {
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value && (n <= Max_Block_Set))
+      {
+        const T* p = first_of_blocks(first, last, s, n, block::All_Lanes);
+
+        if (p != ETL_NULLPTR)
+        {
+          return p;
+        }
+      }
+#endif
+
+      const character_set<T> set(s, n);
+
+      while ((first != last) && set.contains(*first))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// The last character in [first, last) that is not one of the 'n' at 's', or last.
+    //*************************************************************************
+    template <typename T>
+    const T* find_last_not_of(const T* first, const T* last, const T* s, size_t n)
+    {
+      const T* end = last;
+
+#if ETL_USING_SSE2 || ETL_USING_NEON
+      if (is_byte<T>::value && (n <= Max_Block_Set))
+      {
+        const T* p = last_of_blocks(first, end, s, n, block::All_Lanes);
+
+        if (p != ETL_NULLPTR)
+        {
+          return p;
+        }
+      }
+#endif
+
+      const character_set<T> set(s, n);
+
+      const T* p = end;
+
+      while (p != first)
+      {
+        --p;
+
+        if (!set.contains(*p))
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,310 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+///\ingroup private
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../timer.h"
+
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// A hierarchical timing wheel of intrusive timer lists.
+    /// Each level has 32 slots. Level N holds the timers that expire in less
+    /// than 32^(N+1) ticks, in the slot selected by bits 5N to 5N+4 of the
+    /// expiry time. When the time passes a multiple of 32^N, the slot for the
+    /// new time on level N is cascaded down to the lower levels.
+    /// Starting and stopping a timer is O(1). Ticks only visit occupied
+    /// level 0 slots and multiples of 32.
+    /// TTimerData must have the members 'id', 'expiry', 'period', 'repeating',
+    /// 'slot', 'previous' and 'next'.
+    //*************************************************************************
+    template <typename TTimerData>
+    class wheel
+    {
+    public:
+
+      typedef etl::timer_wheel::id::type id_type;
+
+      static ETL_CONSTANT uint_least16_t NO_SLOT = 0xFFFFU;
+
+      //*******************************
+      wheel(TTimerData* ptimers_)
+        : ptimers(ptimers_),
+          now(0U),
+          active_count(0U)
+      {
+        clear();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active_count == 0U;
+      }
+
+      //*******************************
+      /// The number of ticks since the wheel was cleared.
+      //*******************************
+      uint32_t time() const
+      {
+        return now;
+      }
+
+      //*******************************
+      /// Inserts a timer to expire in 'delay' ticks.
+      //*******************************
+      void insert(id_type id_, uint32_t delay)
+      {
+        ptimers[id_].expiry = now + delay;
+        place(id_);
+        ++active_count;
+      }
+
+      //*******************************
+      /// Removes an active timer.
+      //*******************************
+      void remove(id_type id_)
+      {
+        unlink(id_);
+        --active_count;
+      }
+
+      //*******************************
+      /// Advances the time by 'count' ticks, passing each timer that expires
+      /// to 'on_expired', in order of expiry. Repeating timers are reinserted,
+      /// relative to the time that they expired, before 'on_expired' is called.
+      /// The order of timers that expire at the same time is not specified.
+      //*******************************
+      template <typename TOnExpired>
+      void advance(uint32_t count, TOnExpired& on_expired)
+      {
+        const uint32_t target = now + count;
+        uint32_t t = now;
+
+        while (true)
+        {
+          now = t;
+
+          if ((t & Slot_Mask) == 0U)
+          {
+            cascade(t);
+          }
+
+          expire(t & Slot_Mask, on_expired);
+
+          if ((t == target) || empty())
+          {
+            break;
+          }
+
+          // Skip to the next occupied slot or the next cascade, whichever is first.
+          const uint32_t slot = t & Slot_Mask;
+          const uint32_t mask = (slot == Slot_Mask) ? 0U : (occupied[0] & (~uint32_t(0U) << (slot + 1U)));
+          const uint32_t step = (mask != 0U) ? (etl::count_trailing_zeros(mask) - slot) : (Slots - slot);
+          const uint32_t remaining = target - t;
+
+          t += (step < remaining) ? step : remaining;
+        }
+
+        now = target;
+      }
+
+      //*******************************
+      /// Removes all timers and resets the time.
+      //*******************************
+      void clear()
+      {
+        for (size_t i = 0U; i < (Levels * Slots); ++i)
+        {
+          heads[i] = etl::timer_wheel::id::NO_TIMER;
+        }
+
+        for (size_t i = 0U; i < Levels; ++i)
+        {
+          occupied[i] = 0U;
+        }
+
+        now          = 0U;
+        active_count = 0U;
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Slot_Bits = 5U;
+      static ETL_CONSTANT uint32_t Slots     = 1U << Slot_Bits;
+      static ETL_CONSTANT uint32_t Slot_Mask = Slots - 1U;
+      static ETL_CONSTANT uint32_t Levels    = 7U; // Enough for 32 bit times.
+
+      //*******************************
+      /// Adds a timer to the tail of the slot for its expiry time.
+      //*******************************
+      void place(id_type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        const uint32_t delay = timer.expiry - now;
+
+        uint32_t level = 0U;
+
+        while ((level < (Levels - 1U)) && ((delay >> (Slot_Bits * (level + 1U))) != 0U))
+        {
+          ++level;
+        }
+
+        const uint32_t index = (timer.expiry >> (Slot_Bits * level)) & Slot_Mask;
+
+        timer.slot = uint_least16_t((level * Slots) + index);
+
+        id_type& head = heads[timer.slot];
+
+        if (head == etl::timer_wheel::id::NO_TIMER)
+        {
+          head = id_;
+          timer.previous = id_;
+          timer.next     = id_;
+          occupied[level] |= uint32_t(1U) << index;
+        }
+        else
+        {
+          // The list is circular, so the head's previous is the tail.
+          TTimerData& first = ptimers[head];
+          TTimerData& last  = ptimers[first.previous];
+
+          timer.previous = first.previous;
+          timer.next     = head;
+          last.next      = id_;
+          first.previous = id_;
+        }
+      }
+
+      //*******************************
+      /// Removes a timer from its slot.
+      //*******************************
+      void unlink(id_type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+        id_type&    head  = heads[timer.slot];
+
+        if (timer.next == id_)
+        {
+          // The only timer in the slot.
+          head = etl::timer_wheel::id::NO_TIMER;
+          occupied[timer.slot / Slots] &= ~(uint32_t(1U) << (timer.slot & Slot_Mask));
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+          ptimers[timer.next].previous = timer.previous;
+
+          if (head == id_)
+          {
+            head = timer.next;
+          }
+        }
+
+        timer.slot     = NO_SLOT;
+        timer.previous = etl::timer_wheel::id::NO_TIMER;
+        timer.next     = etl::timer_wheel::id::NO_TIMER;
+      }
+
+      //*******************************
+      /// Moves the timers in the current slot of each higher level down.
+      /// A level is only cascaded when the time is at the start of its slot.
+      //*******************************
+      void cascade(uint32_t t)
+      {
+        for (uint32_t level = 1U; level < Levels; ++level)
+        {
+          const uint32_t index = (t >> (Slot_Bits * level)) & Slot_Mask;
+
+          id_type& head = heads[(level * Slots) + index];
+
+          while (head != etl::timer_wheel::id::NO_TIMER)
+          {
+            id_type id = head;
+            unlink(id);
+            place(id);
+          }
+
+          if (index != 0U)
+          {
+            break;
+          }
+        }
+      }
+
+      //*******************************
+      /// Expires the timers in a level 0 slot.
+      //*******************************
+      template <typename TOnExpired>
+      void expire(uint32_t index, TOnExpired& on_expired)
+      {
+        id_type& head = heads[index];
+
+        while (head != etl::timer_wheel::id::NO_TIMER)
+        {
+          TTimerData& timer = ptimers[head];
+
+          unlink(timer.id);
+
+          if (timer.repeating)
+          {
+            // A zero period repeats on the next tick, rather than forever in this one.
+            timer.expiry += (timer.period == 0U) ? 1U : timer.period;
+            place(timer.id);
+          }
+          else
+          {
+            --active_count;
+          }
+
+          on_expired(timer);
+        }
+      }
+
+      TTimerData* const ptimers;
+      uint32_t          now;
+      uint32_t          active_count;
+      uint32_t          occupied[Levels];
+      id_type           heads[Levels * Slots];
+    };
+  }
+}
+
+#endif
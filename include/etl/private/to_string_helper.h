@@ -45,6 +45,8 @@ SOFTWARE.
 #include "../algorithm.h"
 #include "../iterator.h"
 #include "../limits.h"
+#include "grisu.h"
+#include "eisel_lemire.h"
 
 namespace etl
 {
@@ -129,8 +131,176 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// The decimal digit pairs "00" to "99".
+    //***************************************************************************
+    inline const char* decimal_digit_pairs()
+    {
+      static const char pairs[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+      return pairs;
+    }
+
+    //***************************************************************************
+    /// The number of decimal digits in an unsigned value.
+    //***************************************************************************
+    template <typename T>
+    uint32_t count_decimal_digits(T value)
+    {
+      uint32_t count = 1U;
+
+      while (true)
+      {
+        if (value < 10U)    return count;
+        if (value < 100U)   return count + 1U;
+        if (value < 1000U)  return count + 2U;
+        if (value < 10000U) return count + 3U;
+
+        value /= 10000U;
+        count += 4U;
+      }
+    }
+
+    //***************************************************************************
+    /// The number of hexadecimal digits in an unsigned value.
+    //***************************************************************************
+    template <typename T>
+    uint32_t count_hex_digits(T value)
+    {
+      uint32_t count = 1U;
+
+      while (value > 0xFFU)
+      {
+        value >>= 8U;
+        count += 2U;
+      }
+
+      return (value > 0xFU) ? count + 1U : count;
+    }
+
+    //***************************************************************************
+    /// Writes the decimal digits of an unsigned value backwards from 'p',
+    /// two at a time.
+    //***************************************************************************
+    template <typename T, typename TChar>
+    void write_decimal_digits(T value, TChar* p)
+    {
+      const char* pairs = etl::private_to_string::decimal_digit_pairs();
+
+      while (value >= 100U)
+      {
+        const uint32_t index = uint32_t(value % 100U) * 2U;
+        value /= 100U;
+
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const uint32_t index = uint32_t(value) * 2U;
+
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
+      }
+      else
+      {
+        *--p = TChar('0' + value);
+      }
+    }
+
+    //***************************************************************************
+    /// Writes the hexadecimal digits of an unsigned value backwards from 'p',
+    /// a byte at a time.
+    //***************************************************************************
+    template <typename T, typename TChar>
+    void write_hex_digits(T value, TChar* p, bool upper_case)
+    {
+      const char* digits = upper_case ? "0123456789ABCDEF" : "0123456789abcdef";
+
+      while (value > 0xFFU)
+      {
+        *--p = TChar(digits[value & 0xFU]);
+        *--p = TChar(digits[(value >> 4U) & 0xFU]);
+        value >>= 8U;
+      }
+
+      *--p = TChar(digits[value & 0xFU]);
+
+      if (value > 0xFU)
+      {
+        *--p = TChar(digits[value >> 4U]);
+      }
+    }
+
+    //***************************************************************************
+    /// Appends a non-zero decimal or hexadecimal integral directly into the
+    /// string buffer, most significant digit first.
+    /// Returns false, without changing the string, if it would not fit.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    bool add_integral_direct(T value,
+                             TIString& str,
+                             const etl::basic_format_spec<TIString>& format,
+                             const bool negative)
+    {
+      typedef typename TIString::value_type        type;
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      // The other bases show the magnitude of a negative value.
+      const unsigned_t magnitude = etl::is_negative(value) ? unsigned_t(unsigned_t(0U) - unsigned_t(value)) : unsigned_t(value);
+
+      const bool     decimal = (format.get_base() == 10U);
+      const uint32_t digits  = decimal ? count_decimal_digits(magnitude) : count_hex_digits(magnitude);
+      const uint32_t prefix  = decimal ? (negative ? 1U : 0U) : (format.is_show_base() ? 2U : 0U);
+      const uint32_t length  = prefix + digits;
+
+      if (length > str.available())
+      {
+        return false;
+      }
+
+      const size_t position = str.size();
+      str.uninitialized_resize(position + length);
+
+      type* p = str.data() + position;
+
+      if (decimal)
+      {
+        if (negative)
+        {
+          *p = type('-');
+        }
+
+        etl::private_to_string::write_decimal_digits(magnitude, p + length);
+      }
+      else
+      {
+        if (prefix != 0U)
+        {
+          p[0] = type('0');
+          p[1] = format.is_upper_case() ? type('X') : type('x');
+        }
+
+        etl::private_to_string::write_hex_digits(magnitude, p + length, format.is_upper_case());
+      }
+
+      return true;
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
+    /// Decimal and hexadecimal values are written directly into the buffer.
+    /// Other bases, and values that would be truncated, use the generic path.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_integral(T value,
@@ -159,6 +329,11 @@ namespace etl
 
         str.push_back(type('0'));
       }
+      else if (((format.get_base() == 10U) || (format.get_base() == 16U)) &&
+               etl::private_to_string::add_integral_direct(value, str, format, negative))
+      {
+        // Done.
+      }
       else
       {
         // Extract the digits, in reverse order.
@@ -282,8 +457,621 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Whether decimal digits, cut after the first 'keep' of them, round up.
+    /// The digits are within half a unit in the last place of 'value', so the
+    /// dropped digits decide unless they are that close to half of the last
+    /// kept digit. The exact value is then compared with the half way point,
+    /// and an exact tie rounds up.
+    //***************************************************************************
+    inline bool round_up_decimal_digits(const char* digits, int length, int exponent, int keep, const etl::private_grisu::diy_fp& value)
+    {
+      typedef etl::private_eisel_lemire::big_uint<etl::private_eisel_lemire::float_traits<double>::Bigint_Words> bigint_t;
+
+      // The dropped digits, as a fraction of the last kept digit.
+      uint64_t dropped = 0U;
+      uint64_t scale   = 1U;
+
+      for (int i = keep; i < length; ++i)
+      {
+        dropped = (dropped * 10U) + uint64_t(digits[i] - '0');
+        scale  *= 10U;
+      }
+
+      const double fraction = double(dropped) / double(scale);
+
+      // The power of ten of the last kept digit.
+      const int cut = exponent + (length - keep);
+
+      // An upper bound for half a unit in the last place, as a fraction of the last kept digit.
+      const double half_ulp = ldexp(1.0, (value.e - 1) - int(floor(cut * 3.3219280948873623)));
+
+      if (fabs(fraction - 0.5) > (half_ulp + 1e-15))
+      {
+        return fraction > 0.5;
+      }
+
+      // Compare value.f * 2^(value.e + 1) with (2 * kept + 1) * 10^cut.
+      uint64_t kept = 0U;
+
+      for (int i = 0; i < keep; ++i)
+      {
+        kept = (kept * 10U) + uint64_t(digits[i] - '0');
+      }
+
+      bigint_t exact(value.f);
+      bigint_t half_way((kept * 2U) + 1U);
+
+      if (cut >= 0)
+      {
+        half_way.multiply_power_of_5(uint32_t(cut));
+      }
+      else
+      {
+        exact.multiply_power_of_5(uint32_t(-cut));
+      }
+
+      if ((value.e + 1) > cut)
+      {
+        exact.shift_left(uint32_t(value.e + 1 - cut));
+      }
+      else
+      {
+        half_way.shift_left(uint32_t(cut - value.e - 1));
+      }
+
+      return exact.compare(half_way) >= 0;
+    }
+
+    //***************************************************************************
+    /// Rounds decimal digits, value = digits * 10^exponent, to the first 'keep'
+    /// digits, from the exact binary 'value' that they represent, half away
+    /// from zero. Returns the new number of digits, which is zero if the value
+    /// rounds to zero.
+    //***************************************************************************
+    inline int round_decimal_digits(char* digits, int length, int& exponent, int keep, const etl::private_grisu::diy_fp& value)
+    {
+      if (keep >= length)
+      {
+        return length;
+      }
+
+      const bool round_up = (keep >= 0) && etl::private_to_string::round_up_decimal_digits(digits, length, exponent, keep, value);
+
+      exponent += (length - keep);
+
+      if (!round_up)
+      {
+        return (keep < 0) ? 0 : keep;
+      }
+
+      // Round up, dropping any nines that carry.
+      while ((keep > 0) && (digits[keep - 1] == '9'))
+      {
+        --keep;
+        ++exponent;
+      }
+
+      if (keep == 0)
+      {
+        digits[0] = '1';
+        return 1;
+      }
+
+      ++digits[keep - 1];
+
+      return keep;
+    }
+
+    //***************************************************************************
+    /// The most significant digits that the exact value of a double can have.
+    //***************************************************************************
+    static ETL_CONSTANT int Max_Exact_Digits = 767;
+
+    //***************************************************************************
+    /// Whether the shortest digits of 'value', followed by zeros, are the value
+    /// rounded at the power of ten 'cut'. They are when a unit in the last place
+    /// of the value is less than a unit at the cut, as the shortest digits are
+    /// within half a unit in the last place.
+    //***************************************************************************
+    inline bool shortest_digits_are_exact(const etl::private_grisu::diy_fp& value, int cut)
+    {
+      return (value.f == 0U) || (value.e < int(floor(cut * 3.3219280948873623)));
+    }
+
+    //***************************************************************************
+    /// Generates the exact decimal digits of 'value', value = digits * 10^exponent,
+    /// rounded half away from zero.
+    /// If 'significant' is zero the value is rounded at the power of ten 'cut',
+    /// otherwise to 'significant' digits.
+    /// 'power' is the power of ten of the first digit, which may be one out.
+    /// Trailing zeros are not generated, so there are at most Max_Exact_Digits.
+    /// Returns the number of digits, which is zero if the value rounds to zero.
+    //***************************************************************************
+    inline int exact_decimal_digits(const etl::private_grisu::diy_fp& value, int power, int cut, int significant, char* digits, int& exponent)
+    {
+      typedef etl::private_eisel_lemire::big_uint<etl::private_eisel_lemire::float_traits<double>::Bigint_Words> bigint_t;
+
+      // The position of the next digit, starting one above the estimate.
+      int position = power + 1;
+
+      if ((significant == 0) && ((position + 1) < cut))
+      {
+        exponent = cut;
+        return 0;
+      }
+
+      // rest / scale = value / 10^(position + 1), which is less than 1.
+      bigint_t rest(value.f);
+      bigint_t scale(1U);
+
+      if (value.e >= 0)
+      {
+        rest.shift_left(uint32_t(value.e));
+      }
+      else
+      {
+        scale.shift_left(uint32_t(-value.e));
+      }
+
+      if ((position + 1) >= 0)
+      {
+        scale.multiply_power_of_5(uint32_t(position + 1));
+        scale.shift_left(uint32_t(position + 1));
+      }
+      else
+      {
+        rest.multiply_power_of_5(uint32_t(-(position + 1)));
+        rest.shift_left(uint32_t(-(position + 1)));
+      }
+
+      int length = 0;
+
+      while (!rest.is_zero() && ((significant == 0) ? (position >= cut) : (length < significant)))
+      {
+        rest.multiply(10U);
+
+        char digit = '0';
+
+        while (rest.compare(scale) >= 0)
+        {
+          rest.subtract(scale);
+          ++digit;
+        }
+
+        // Leading zeros are skipped.
+        if ((length != 0) || (digit != '0'))
+        {
+          digits[length++] = digit;
+        }
+
+        --position;
+      }
+
+      exponent = position + 1;
+
+      if (!rest.is_zero())
+      {
+        // Round up if the rest is at least half a unit of the last digit.
+        rest.shift_left(1U);
+
+        if (rest.compare(scale) >= 0)
+        {
+          while ((length > 0) && (digits[length - 1] == '9'))
+          {
+            --length;
+            ++exponent;
+          }
+
+          if (length == 0)
+          {
+            digits[0] = '1';
+            length    = 1;
+          }
+          else
+          {
+            ++digits[length - 1];
+          }
+        }
+      }
+
+      return length;
+    }
+
+    //***************************************************************************
+    /// Writes characters directly into a string buffer.
+    //***************************************************************************
+    template <typename TChar>
+    class buffer_writer
+    {
+    public:
+
+      explicit buffer_writer(TChar* p_)
+        : p(p_)
+      {
+      }
+
+      void put(char c)
+      {
+        *p++ = TChar(c);
+      }
+
+      void put(char c, int count)
+      {
+        while (count-- > 0)
+        {
+          *p++ = TChar(c);
+        }
+      }
+
+      void put(const char* first, const char* last)
+      {
+        while (first != last)
+        {
+          *p++ = TChar(*first++);
+        }
+      }
+
+    private:
+
+      TChar* p;
+    };
+
+    //***************************************************************************
+    /// Pushes characters on to the back of a string, which records any
+    /// truncation.
+    //***************************************************************************
+    template <typename TIString>
+    class push_back_writer
+    {
+    public:
+
+      typedef typename TIString::value_type type;
+
+      explicit push_back_writer(TIString& str_)
+        : str(str_)
+      {
+      }
+
+      void put(char c)
+      {
+        str.push_back(type(c));
+      }
+
+      void put(char c, int count)
+      {
+        while (count-- > 0)
+        {
+          str.push_back(type(c));
+        }
+      }
+
+      void put(const char* first, const char* last)
+      {
+        while (first != last)
+        {
+          str.push_back(type(*first++));
+        }
+      }
+
+    private:
+
+      TIString& str;
+    };
+
+    //***************************************************************************
+    /// Appends 'length' characters from 'formatter' to the string.
+    /// They are written directly into the buffer if they all fit.
+    //***************************************************************************
+    template <typename TIString, typename TFormatter>
+    void append_formatted(TIString& str, int length, const TFormatter& formatter)
+    {
+      typedef typename TIString::value_type type;
+
+      if (size_t(length) <= str.available())
+      {
+        const size_t position = str.size();
+        str.uninitialized_resize(position + size_t(length));
+
+        etl::private_to_string::buffer_writer<type> writer(str.data() + position);
+        formatter(writer);
+      }
+      else
+      {
+        etl::private_to_string::push_back_writer<TIString> writer(str);
+        formatter(writer);
+      }
+    }
+
+    //***************************************************************************
+    /// Formats rounded digits in fixed notation, with 'precision' digits after
+    /// the decimal point.
+    //***************************************************************************
+    struct fixed_formatter
+    {
+      fixed_formatter(const char* digits_, int length_, int exponent_, int precision_, bool negative_)
+        : digits(digits_)
+        , length(length_)
+        , integral_digits((length_ == 0) ? 0 : (exponent_ + length_))
+        , precision(precision_)
+        , negative(negative_)
+      {
+      }
+
+      //*******************************
+      int size() const
+      {
+        return (negative ? 1 : 0) + ((integral_digits > 0) ? integral_digits : 1) + ((precision > 0) ? (precision + 1) : 0);
+      }
+
+      //*******************************
+      template <typename TWriter>
+      void operator()(TWriter& writer) const
+      {
+        if (negative)
+        {
+          writer.put('-');
+        }
+
+        if (integral_digits <= 0)
+        {
+          writer.put('0');
+        }
+        else
+        {
+          const int n = (length < integral_digits) ? length : integral_digits;
+
+          writer.put(digits, digits + n);
+          writer.put('0', integral_digits - n);
+        }
+
+        if (precision > 0)
+        {
+          writer.put('.');
+
+          // Zeros between the decimal point and the first digit.
+          const int leading = (integral_digits < 0) ? ((-integral_digits < precision) ? -integral_digits : precision) : 0;
+          writer.put('0', leading);
+
+          const int first = (integral_digits > 0) ? integral_digits : 0;
+          const int last  = (length < (integral_digits + precision)) ? length : (integral_digits + precision);
+
+          int written = leading;
+
+          if (last > first)
+          {
+            writer.put(digits + first, digits + last);
+            written += (last - first);
+          }
+
+          writer.put('0', precision - written);
+        }
+      }
+
+      const char* digits;
+      int         length;
+      int         integral_digits; // The number of digits before the decimal point.
+      int         precision;
+      bool        negative;
+    };
+
+    //***************************************************************************
+    /// Formats rounded digits in scientific notation, with 'precision' digits
+    /// after the decimal point and an exponent of at least two digits.
+    //***************************************************************************
+    struct scientific_formatter
+    {
+      scientific_formatter(const char* digits_, int length_, int exponent_, int precision_, bool negative_, bool upper_case_)
+        : digits(digits_)
+        , length(length_)
+        , power((digits_[0] == '0') ? 0 : (exponent_ + length_ - 1))
+        , precision(precision_)
+        , negative(negative_)
+        , upper_case(upper_case_)
+      {
+      }
+
+      //*******************************
+      int size() const
+      {
+        return (negative ? 1 : 0) + 1 + ((precision > 0) ? (precision + 1) : 0) + 2 + (((power >= 100) || (power <= -100)) ? 3 : 2);
+      }
+
+      //*******************************
+      template <typename TWriter>
+      void operator()(TWriter& writer) const
+      {
+        if (negative)
+        {
+          writer.put('-');
+        }
+
+        writer.put(digits[0]);
+
+        if (precision > 0)
+        {
+          const int n = ((length - 1) < precision) ? (length - 1) : precision;
+
+          writer.put('.');
+          writer.put(digits + 1, digits + 1 + n);
+          writer.put('0', precision - n);
+        }
+
+        writer.put(upper_case ? 'E' : 'e');
+        writer.put((power < 0) ? '-' : '+');
+
+        const int magnitude = (power < 0) ? -power : power;
+
+        if (magnitude >= 100)
+        {
+          writer.put(char('0' + (magnitude / 100)));
+        }
+
+        writer.put(char('0' + ((magnitude / 10) % 10)));
+        writer.put(char('0' + (magnitude % 10)));
+      }
+
+      const char* digits;
+      int         length;
+      int         power;
+      int         precision;
+      bool        negative;
+      bool        upper_case;
+    };
+
+    //***************************************************************************
+    /// Appends digits, value = digits * 10^exponent, in fixed notation.
+    /// 'value' is the binary value that the digits were generated from.
+    /// If the precision reaches past the digits, and they are not exact to it,
+    /// the exact digits of the value are used instead.
+    //***************************************************************************
+    template <typename TIString>
+    void add_fixed_digits(char* digits, int length, int exponent, int precision, bool negative, const etl::private_grisu::diy_fp& value, TIString& str)
+    {
+      const int keep = length + exponent + precision;
+
+      if ((keep >= length) && !etl::private_to_string::shortest_digits_are_exact(value, -precision))
+      {
+        char exact_digits[Max_Exact_Digits];
+        int  exact_exponent;
+        const int exact_length = etl::private_to_string::exact_decimal_digits(value, exponent + length - 1, -precision, 0, exact_digits, exact_exponent);
+
+        const etl::private_to_string::fixed_formatter formatter(exact_digits, exact_length, exact_exponent, precision, negative);
+
+        etl::private_to_string::append_formatted(str, formatter.size(), formatter);
+      }
+      else
+      {
+        length = etl::private_to_string::round_decimal_digits(digits, length, exponent, keep, value);
+
+        const etl::private_to_string::fixed_formatter formatter(digits, length, exponent, precision, negative);
+
+        etl::private_to_string::append_formatted(str, formatter.size(), formatter);
+      }
+    }
+
+    //***************************************************************************
+    /// Appends digits, value = digits * 10^exponent, in scientific notation.
+    /// 'value' is the binary value that the digits were generated from.
+    /// If the precision reaches past the digits, and they are not exact to it,
+    /// the exact digits of the value are used instead.
+    //***************************************************************************
+    template <typename TIString>
+    void add_scientific_digits(char* digits, int length, int exponent, int precision, bool negative, bool upper_case, const etl::private_grisu::diy_fp& value, TIString& str)
+    {
+      const int power = exponent + length - 1;
+
+      // The first digit of the value may be one place below that of the digits.
+      if (((precision + 1) >= length) && !etl::private_to_string::shortest_digits_are_exact(value, power - precision - 1))
+      {
+        char exact_digits[Max_Exact_Digits];
+        int  exact_exponent;
+        const int exact_length = etl::private_to_string::exact_decimal_digits(value, power, 0, precision + 1, exact_digits, exact_exponent);
+
+        const etl::private_to_string::scientific_formatter formatter(exact_digits, exact_length, exact_exponent, precision, negative, upper_case);
+
+        etl::private_to_string::append_formatted(str, formatter.size(), formatter);
+      }
+      else
+      {
+        length = etl::private_to_string::round_decimal_digits(digits, length, exponent, precision + 1, value);
+
+        const etl::private_to_string::scientific_formatter formatter(digits, length, exponent, precision, negative, upper_case);
+
+        etl::private_to_string::append_formatted(str, formatter.size(), formatter);
+      }
+    }
+
+    //***************************************************************************
+    /// Appends the shortest digits, value = digits * 10^exponent, in fixed or
+    /// scientific notation.
+    //***************************************************************************
+    template <typename TIString>
+    void add_general_digits(const char* digits, int length, int exponent, int max_fixed_power, bool negative, bool upper_case, TIString& str)
+    {
+      const int power = (digits[0] == '0') ? 0 : (exponent + length - 1);
+
+      if ((power >= -4) && (power < max_fixed_power))
+      {
+        const etl::private_to_string::fixed_formatter formatter(digits, length, exponent, (exponent < 0) ? -exponent : 0, negative);
+
+        etl::private_to_string::append_formatted(str, formatter.size(), formatter);
+      }
+      else
+      {
+        const etl::private_to_string::scientific_formatter formatter(digits, length, exponent, length - 1, negative, upper_case);
+
+        etl::private_to_string::append_formatted(str, formatter.size(), formatter);
+      }
+    }
+
     //***************************************************************************
     /// Helper function for floating point.
+    /// The value is converted to the shortest decimal digits that read back as
+    /// the same value, which are then rounded to the requested precision.
+    /// Fixed and scientific notation show the exact binary value, rounded to
+    /// the precision, so 2.675, which is stored as 2.67499999..., with a
+    /// precision of 2 is "2.67". Exact ties round away from zero.
+    /// General notation shows the shortest digits.
+    /// long double is formatted as double.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point(const T value,
+                            TIString& str,
+                            const etl::basic_format_spec<TIString>& format,
+                            const bool append)
+    {
+      typedef typename TIString::iterator iterator;
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type shortest_t;
+
+      if (!append)
+      {
+        str.clear();
+      }
+
+      iterator start = str.end();
+
+      if (isnan(value) || isinf(value))
+      {
+        etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
+      }
+      else
+      {
+        // absolute() keeps the sign of negative zero.
+        const shortest_t magnitude = (value == T(0)) ? shortest_t(0) : shortest_t(etl::absolute(value));
+
+        char digits[etl::private_grisu::Max_Digits];
+        int  exponent;
+        int  length = etl::private_grisu::shortest_digits(magnitude, digits, exponent);
+
+        bool lower_boundary_is_closer;
+        const etl::private_grisu::diy_fp exact = etl::private_grisu::decompose(magnitude, lower_boundary_is_closer);
+
+        const int  precision = int(format.get_precision());
+        const bool negative  = etl::is_negative(value);
+
+        if (format.is_scientific())
+        {
+          etl::private_to_string::add_scientific_digits(digits, length, exponent, precision, negative, format.is_upper_case(), exact, str);
+        }
+        else if (format.is_general())
+        {
+          etl::private_to_string::add_general_digits(digits, length, exponent, etl::private_grisu::float_traits<shortest_t>::Max_Digits10, negative, format.is_upper_case(), str);
+        }
+        else
+        {
+          etl::private_to_string::add_fixed_digits(digits, length, exponent, precision, negative, exact, str);
+        }
+      }
+
+      etl::private_to_string::add_alignment(str, start, format);
+    }
+#else
+    //***************************************************************************
+    /// Helper function for floating point.
+    /// Without 64 bit types the value must be less than 2^32 and is always
+    /// shown in fixed notation.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_floating_point(const T value,
@@ -342,6 +1130,7 @@ namespace etl
 
       etl::private_to_string::add_alignment(str, start, format);
     }
+#endif
 
     //***************************************************************************
     /// Helper function for denominated integers.
@@ -0,0 +1,592 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "power.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "placement_new.h"
+
+///\defgroup queue_mpmc_atomic Lock-free multi producer, multi consumer queue
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      // Read the read index first. The read index never passes the write
+      // index, so the difference is never negative, but it may be more than
+      // the capacity if items are pushed between the two loads.
+      const position_type read_index  = read.load(etl::memory_order_acquire);
+      const position_type write_index = write.load(etl::memory_order_acquire);
+
+      const position_type n = position_type(write_index - read_index);
+
+      return (n > MAX_SIZE) ? MAX_SIZE : size_type(n);
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    /// The positions are at least 32 bits, whatever the memory model, so that
+    /// a thread would have to be pre-empted for billions of operations before
+    /// a stale position could match again.
+    typedef typename etl::conditional<(sizeof(size_type) < sizeof(uint32_t)), uint32_t, size_type>::type position_type;
+    typedef typename etl::make_signed<position_type>::type difference_type;
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : write(0),
+        read(0),
+        MAX_SIZE(max_size_),
+        MASK(max_size_ - 1)
+    {
+    }
+
+    //*************************************************************************
+    /// The signed distance from 'position' to 'sequence'.
+    //*************************************************************************
+    static difference_type distance(position_type sequence, position_type position)
+    {
+      return difference_type(position_type(sequence - position));
+    }
+
+    etl::atomic<position_type> write; ///< The next position to push to.
+    etl::atomic<position_type> read;  ///< The next position to pop from.
+    const size_type MAX_SIZE;     ///< The maximum number of items in the queue.
+    const size_type MASK;         ///< Maps a position to a slot.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// Each slot has a sequence number that says whether it is ready to be pushed
+  /// to or popped from on the current lap of the buffer. Producers and consumers
+  /// claim a position with a compare and swap, so they only contend with each
+  /// other when they are after the same slot.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                        rvalue_reference;///< An rvalue_reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+  protected:
+
+    typedef typename base_t::position_type position_type;
+
+  public:
+
+    //*************************************************************************
+    /// A slot in the queue.
+    //*************************************************************************
+    struct slot
+    {
+      etl::atomic<position_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    using base_t::write;
+    using base_t::read;
+    using base_t::MAX_SIZE;
+    using base_t::MASK;
+    using base_t::distance;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value);
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::move(value));
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::forward<Args>(args)...);
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1);
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2);
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3);
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      position_type position;
+      slot* p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3, value4);
+        p_slot->sequence.store(position_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      position_type position;
+      slot* p_slot = claim_pop_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        T& item = *reinterpret_cast<T*>(&p_slot->value);
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+        value = etl::move(item);
+#else
+        value = item;
+#endif
+
+        item.~T();
+        p_slot->sequence.store(position_type(position + MAX_SIZE), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      position_type position;
+      slot* p_slot = claim_pop_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_slot->value)->~T();
+        p_slot->sequence.store(position_type(position + MAX_SIZE), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot* p_slots_, size_type max_size_)
+      : base_t(max_size_),
+        p_slots(p_slots_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the sequence numbers for an empty queue.
+    /// Called by the derived class, once the slots are constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_slots[i].sequence.store(position_type(i), etl::memory_order_relaxed);
+      }
+
+      write.store(0, etl::memory_order_relaxed);
+      read.store(0, etl::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the slot for the next push.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    slot* claim_push_slot(position_type& position)
+    {
+      position = write.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot& s = p_slots[position & MASK];
+
+        const typename base_t::difference_type d = distance(s.sequence.load(etl::memory_order_acquire), position);
+
+        if (d == 0)
+        {
+          // The slot is free on this lap. Try to take the position.
+          if (write.compare_exchange_weak(position, position_type(position + 1), etl::memory_order_relaxed))
+          {
+            return &s;
+          }
+        }
+        else if (d < 0)
+        {
+          // The slot still holds the value from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer took the position.
+          position = write.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims the slot for the next pop.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    slot* claim_pop_slot(position_type& position)
+    {
+      position = read.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot& s = p_slots[position & MASK];
+
+        const typename base_t::difference_type d = distance(s.sequence.load(etl::memory_order_acquire), position_type(position + 1));
+
+        if (d == 0)
+        {
+          // The slot has been published on this lap. Try to take the position.
+          if (read.compare_exchange_weak(position, position_type(position + 1), etl::memory_order_relaxed))
+          {
+            return &s;
+          }
+        }
+        else if (d < 0)
+        {
+          // Nothing has been published to the slot yet.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer took the position.
+          position = read.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    slot* p_slots; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity lock-free mpmc queue.
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be a power of 2.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef typename etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<SIZE>::value, "Size must be a power of 2");
+    ETL_STATIC_ASSERT((SIZE <= ((etl::integral_limits<size_type>::max / 2) + 1)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(slots, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The slots used in the queue.
+    typename base_t::slot slots[MAX_SIZE];
+  };
+}
+
+#endif
+
+#endif
@@ -42,6 +42,8 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "iterator.h"
+#include "type_traits.h"
 
 #if ETL_HAS_ATOMIC
 
@@ -128,12 +130,78 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
+      : RESERVED(reserved_),
+        write(0),
+        cached_read(0),
         read(0),
-        RESERVED(reserved_)
+        cached_write(0)
     {
     }
 
+    //*************************************************************************
+    /// Is there space to push to 'next_index'?
+    /// Called from the push thread. Only loads the read index when the cached
+    /// copy says that the queue is full.
+    //*************************************************************************
+    bool can_push(size_type next_index)
+    {
+      if (next_index == cached_read)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+      }
+
+      return next_index != cached_read;
+    }
+
+    //*************************************************************************
+    /// Is there an item to pop from 'read_index'?
+    /// Called from the pop thread. Only loads the write index when the cached
+    /// copy says that the queue is empty.
+    //*************************************************************************
+    bool can_pop(size_type read_index)
+    {
+      if (read_index == cached_write)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+      }
+
+      return read_index != cached_write;
+    }
+
+    //*************************************************************************
+    /// The number of free places, as seen from the push thread.
+    /// Only loads the read index when the cached copy shows less than 'wanted'.
+    //*************************************************************************
+    size_type push_space(size_type write_index, size_type wanted)
+    {
+      size_type space = free_space(write_index, cached_read);
+
+      if (space < wanted)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+        space       = free_space(write_index, cached_read);
+      }
+
+      return space;
+    }
+
+    //*************************************************************************
+    /// The number of items, as seen from the pop thread.
+    /// Only loads the write index when the cached copy shows less than 'wanted'.
+    //*************************************************************************
+    size_type pop_count(size_type read_index, size_type wanted)
+    {
+      size_type count = used_space(read_index, cached_write);
+
+      if (count < wanted)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+        count        = used_space(read_index, cached_write);
+      }
+
+      return count;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -149,12 +217,42 @@ namespace etl
       return index;
     }
 
+    // The push thread's and the pop thread's indexes are kept on separate
+    // cache lines, so that each thread only invalidates the other's line when
+    // it publishes.
+    const size_type RESERVED;     ///< The maximum number of items in the queue.
+#if ETL_CACHE_LINE_SIZE > 0
+    char padding1[ETL_CACHE_LINE_SIZE];
+#endif
     etl::atomic<size_type> write; ///< Where to input new data.
+    size_type cached_read;        ///< The push thread's copy of 'read'.
+#if ETL_CACHE_LINE_SIZE > 0
+    char padding2[ETL_CACHE_LINE_SIZE];
+#endif
     etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    size_type cached_write;       ///< The pop thread's copy of 'write'.
+#if ETL_CACHE_LINE_SIZE > 0
+    char padding3[ETL_CACHE_LINE_SIZE];
+#endif
 
   private:
 
+    //*************************************************************************
+    /// The number of free places between the write and read indexes.
+    //*************************************************************************
+    size_type free_space(size_type write_index, size_type read_index) const
+    {
+      return (read_index > write_index) ? size_type(read_index - write_index - 1) : size_type(RESERVED - write_index + read_index - 1);
+    }
+
+    //*************************************************************************
+    /// The number of items between the read and write indexes.
+    //*************************************************************************
+    size_type used_space(size_type read_index, size_type write_index) const
+    {
+      return (write_index >= read_index) ? size_type(write_index - read_index) : size_type(RESERVED - read_index + write_index);
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -203,6 +301,10 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::can_push;
+    using base_t::can_pop;
+    using base_t::push_space;
+    using base_t::pop_count;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +314,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +336,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -259,7 +361,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -282,7 +384,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -305,7 +407,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -328,7 +430,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -351,7 +453,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -365,6 +467,47 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Pushes values from a range to the queue, until the range is empty or
+    /// the queue is full.
+    /// The values are published together, with one store of the write index.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type space       = push_space(write_index, push_wanted(first, last));
+      size_type count       = 0;
+
+      while (first != last)
+      {
+        if (count == space)
+        {
+          // The cached read index may be out of date.
+          space = count + push_space(write_index, 1);
+
+          if (count == space)
+          {
+            break;
+          }
+        }
+
+        ::new (&p_buffer[write_index]) T(*first);
+
+        write_index = get_next_index(write_index, RESERVED);
+        ++first;
+        ++count;
+      }
+
+      if (count != 0)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
     //*************************************************************************
     /// Peek the next value in the queue without removing it.
     //*************************************************************************
@@ -372,7 +515,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -390,7 +533,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -418,7 +561,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -433,6 +576,44 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Pops up to 'max_count' values from the queue to an output iterator.
+    /// The places are released together, with one store of the read index.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type count      = pop_count(read_index, max_count);
+
+      if (count > max_count)
+      {
+        count = max_count;
+      }
+
+      for (size_type i = 0; i < count; ++i)
+      {
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03)
+        *out = etl::move(p_buffer[read_index]);
+#else
+        *out = p_buffer[read_index];
+#endif
+        ++out;
+
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      if (count != 0)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     //*************************************************************************
@@ -479,6 +660,29 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// The number of places wanted for a range of forward iterators.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<etl::is_forward_iterator_concept<TIterator>::value, size_type>::type
+      push_wanted(TIterator first, TIterator last) const
+    {
+      const size_t length = size_t(etl::distance(first, last));
+
+      return (length < size_t(RESERVED - 1)) ? size_type(length) : size_type(RESERVED - 1);
+    }
+
+    //*************************************************************************
+    /// The number of places wanted for a range of input iterators.
+    /// The length is unknown, so only one is asked for.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_forward_iterator_concept<TIterator>::value, size_type>::type
+      push_wanted(TIterator, TIterator) const
+    {
+      return 1;
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_atomic(const iqueue_spsc_atomic&) ETL_DELETE;
     iqueue_spsc_atomic& operator =(const iqueue_spsc_atomic&) ETL_DELETE;
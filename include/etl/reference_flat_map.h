@@ -42,6 +42,10 @@ SOFTWARE.
 #include "exception.h"
 #include "static_assert.h"
 #include "iterator.h"
+#include "algorithm.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
 
 //*****************************************************************************
 ///\defgroup reference_flat_map reference_flat_map
@@ -319,15 +323,44 @@ namespace etl
     {
     public:
 
-      bool operator ()(const value_type& element, key_type key) const
+      bool operator ()(const value_type& element, key_parameter_t key) const
+      {
+        return comp(element.first, key);
+      }
+
+      bool operator ()(key_parameter_t key, const value_type& element) const
+      {
+        return comp(key, element.first);
+      }
+
+#if ETL_CPP11_SUPPORTED
+      template <typename K>
+      bool operator ()(const value_type& element, const K& key) const
       {
         return comp(element.first, key);
       }
 
-      bool operator ()(key_type key, const value_type& element) const
+      template <typename K>
+      bool operator ()(const K& key, const value_type& element) const
       {
         return comp(key, element.first);
       }
+#endif
+
+      key_compare comp;
+    };
+
+    //*********************************************************************
+    /// How to compare elements in the lookup.
+    //*********************************************************************
+    class LookupCompare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return comp(lhs->first, rhs->first);
+      }
 
       key_compare comp;
     };
@@ -518,11 +551,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -550,18 +579,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_map.
+    /// The values are appended, sorted and then merged with the existing elements.
     /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted by key and with no duplicates, to the reference_flat_map.
+    /// The values are appended and then merged with the existing elements.
+    /// Inserting into an empty reference_flat_map is O(N).
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, false);
     }
 
     //*********************************************************************
@@ -661,6 +701,58 @@ namespace etl
       return end();
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      iterator itr = lower_bound(key);
+
+      if (itr != end())
+      {
+        if (keys_are_equal(itr->first, key))
+        {
+          return itr;
+        }
+        else
+        {
+          return end();
+        }
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Finds an element, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      if (itr != end())
+      {
+        if (keys_are_equal(itr->first, key))
+        {
+          return itr;
+        }
+        else
+        {
+          return end();
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -671,6 +763,19 @@ namespace etl
       return (find(key) == end()) ? 0U : 1U;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -691,6 +796,30 @@ namespace etl
       return etl::lower_bound(cbegin(), cend(), key, compare);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return etl::lower_bound(begin(), end(), key, compare);
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return etl::lower_bound(cbegin(), cend(), key, compare);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -711,6 +840,30 @@ namespace etl
       return etl::upper_bound(begin(), end(), key, compare);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return etl::upper_bound(begin(), end(), key, compare);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return etl::upper_bound(begin(), end(), key, compare);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -735,6 +888,34 @@ namespace etl
       return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
+
+      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key, for transparent comparators.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
+
+      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the reference_flat_map.
     ///\return The current size of the reference_flat_map.
@@ -835,6 +1016,68 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, ignoring the sort order.
+    /// Must be followed by a call to merge_appended.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n' elements.
+    ///\param n The number of elements before the first append.
+    //*********************************************************************
+    void sort_appended(size_t n)
+    {
+      etl::sort(lookup.begin() + n, lookup.end(), lookup_compare);
+    }
+
+    //*********************************************************************
+    /// Merges the sorted values appended after the first 'n' elements into the map.
+    /// Appended values with keys that are already present are moved to the end
+    /// and are left for the caller to erase.
+    ///\param n The number of elements before the first append.
+    ///\return An iterator to the first of the values to erase.
+    //*********************************************************************
+    iterator merge_appended(size_t n)
+    {
+      typename lookup_t::iterator first    = lookup.begin();
+      typename lookup_t::iterator middle   = first + n;
+      typename lookup_t::iterator last     = lookup.end();
+      typename lookup_t::iterator existing = first;
+      typename lookup_t::iterator kept     = middle;
+
+      for (typename lookup_t::iterator itr = middle; itr != last; ++itr)
+      {
+        // Already appended?
+        bool is_duplicate = (kept != middle) && !lookup_compare(*(kept - 1), *itr);
+
+        if (!is_duplicate)
+        {
+          // Already in the map? The appended values are sorted, so the search can start from the last one found.
+          existing     = etl::lower_bound(existing, middle, *itr, lookup_compare);
+          is_duplicate = (existing != middle) && !lookup_compare(*itr, *existing);
+        }
+
+        if (!is_duplicate)
+        {
+          if (kept != itr)
+          {
+            ETL_OR_STD::swap(*kept, *itr);
+          }
+
+          ++kept;
+        }
+      }
+
+      etl::inplace_merge(first, middle, kept, lookup_compare);
+
+      return iterator(kept);
+    }
+
     //*********************************************************************
     /// Check to see if the keys are equal.
     //*********************************************************************
@@ -843,8 +1086,53 @@ namespace etl
       return !key_compare()(key1, key2) && !key_compare()(key2, key1);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Check to see if the keys are equal, for transparent comparators.
+    //*********************************************************************
+    template <typename K>
+    bool keys_are_equal(key_parameter_t key1, const K& key2) const
+    {
+      return !key_compare()(key1, key2) && !key_compare()(key2, key1);
+    }
+#endif
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values by appending and merging.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    ///\param is_unsorted <b>true</b> if the values must be sorted before merging.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_unsorted)
+    {
+      while (first != last)
+      {
+        size_t n = size();
+
+        // Append as many as will fit.
+        while ((first != last) && !full())
+        {
+          append(*first++);
+        }
+
+        if (is_unsorted)
+        {
+          sort_appended(n);
+        }
+
+        erase(merge_appended(n), end());
+
+        // Still full? The next value can only be inserted if its key is already present.
+        if ((first != last) && full())
+        {
+          insert(*first++);
+        }
+      }
+    }
+
     // Disable copy construction and assignment.
     ireference_flat_map(const ireference_flat_map&);
     ireference_flat_map& operator = (const ireference_flat_map&);
@@ -853,6 +1141,8 @@ namespace etl
 
     Compare compare;
 
+    LookupCompare lookup_compare;
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -931,6 +1221,20 @@ namespace etl
       ireference_flat_map<TKey, TValue, TCompare>::assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted by key and has no duplicates.
+    /// Construction is O(N).
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    reference_flat_map(etl::sorted_unique_t, TIterator first, TIterator last)
+      : ireference_flat_map<TKey, TValue, TCompare>(lookup)
+    {
+      ireference_flat_map<TKey, TValue, TCompare>::insert(etl::sorted_unique_t(), first, last);
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
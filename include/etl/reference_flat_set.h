@@ -428,11 +428,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -460,18 +456,29 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_set.
+    /// The values are appended, sorted and then merged with the existing elements.
     /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, already sorted and with no duplicates, to the reference_flat_set.
+    /// The values are appended and then merged with the existing elements.
+    /// Inserting into an empty reference_flat_set is O(N).
+    /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, false);
     }
 
     //*********************************************************************
@@ -741,8 +748,119 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, ignoring the sort order.
+    /// Must be followed by a call to merge_appended.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n' elements.
+    ///\param n The number of elements before the first append.
+    //*********************************************************************
+    void sort_appended(size_t n)
+    {
+      etl::sort(lookup.begin() + n, lookup.end(), lookup_compare);
+    }
+
+    //*********************************************************************
+    /// Merges the sorted values appended after the first 'n' elements into the set.
+    /// Appended values that are already present are moved to the end
+    /// and are left for the caller to erase.
+    ///\param n The number of elements before the first append.
+    ///\return An iterator to the first of the values to erase.
+    //*********************************************************************
+    iterator merge_appended(size_t n)
+    {
+      typename lookup_t::iterator first    = lookup.begin();
+      typename lookup_t::iterator middle   = first + n;
+      typename lookup_t::iterator last     = lookup.end();
+      typename lookup_t::iterator existing = first;
+      typename lookup_t::iterator kept     = middle;
+
+      for (typename lookup_t::iterator itr = middle; itr != last; ++itr)
+      {
+        // Already appended?
+        bool is_duplicate = (kept != middle) && !lookup_compare(*(kept - 1), *itr);
+
+        if (!is_duplicate)
+        {
+          // Already in the set? The appended values are sorted, so the search can start from the last one found.
+          existing     = etl::lower_bound(existing, middle, *itr, lookup_compare);
+          is_duplicate = (existing != middle) && !lookup_compare(*itr, *existing);
+        }
+
+        if (!is_duplicate)
+        {
+          if (kept != itr)
+          {
+            ETL_OR_STD::swap(*kept, *itr);
+          }
+
+          ++kept;
+        }
+      }
+
+      etl::inplace_merge(first, middle, kept, lookup_compare);
+
+      return iterator(kept);
+    }
+
   private:
 
+    //*********************************************************************
+    /// How to compare elements in the lookup.
+    //*********************************************************************
+    class LookupCompare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return comp(*lhs, *rhs);
+      }
+
+      key_compare comp;
+    };
+
+    //*********************************************************************
+    /// Inserts a range of values by appending and merging.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    ///\param is_unsorted <b>true</b> if the values must be sorted before merging.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_unsorted)
+    {
+      while (first != last)
+      {
+        size_t n = size();
+
+        // Append as many as will fit.
+        while ((first != last) && !full())
+        {
+          append(*first++);
+        }
+
+        if (is_unsorted)
+        {
+          sort_appended(n);
+        }
+
+        erase(merge_appended(n), end());
+
+        // Still full? The next value can only be inserted if it is already present.
+        if ((first != last) && full())
+        {
+          insert(*first++);
+        }
+      }
+    }
+
     // Disable copy construction.
     ireference_flat_set(const ireference_flat_set&);
     ireference_flat_set& operator =(const ireference_flat_set&);
@@ -751,6 +869,8 @@ namespace etl
 
     TKeyCompare compare;
 
+    LookupCompare lookup_compare;
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -808,6 +928,20 @@ namespace etl
       ireference_flat_set<TKey, TKeyCompare>::assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and has no duplicates.
+    /// Construction is O(N).
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    reference_flat_set(etl::sorted_unique_t, TIterator first, TIterator last)
+      : ireference_flat_set<TKey, TKeyCompare>(lookup)
+    {
+      ireference_flat_set<TKey, TKeyCompare>::insert(etl::sorted_unique_t(), first, last);
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -329,6 +329,15 @@ namespace etl
     {
     }
 
+    //*******************************************
+    /// Sets the notifier that the task calls from task_set_ready().
+    //*******************************************
+    static void set_task_ready_notifier(etl::task& task, etl::itask_ready_notifier* p_notifier, size_t index)
+    {
+      task.p_ready_notifier = p_notifier;
+      task.ready_index      = index;
+    }
+
     bool scheduler_running;
     bool scheduler_exit;
     etl::ifunction<void>* p_idle_callback;
@@ -0,0 +1,211 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SCHEDULER_EVENT_DRIVEN_INCLUDED
+#define ETL_SCHEDULER_EVENT_DRIVEN_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "binary.h"
+#include "vector.h"
+#include "task.h"
+#include "scheduler.h"
+
+///\defgroup scheduler_event_driven Event driven scheduler
+/// A scheduler that keeps a bitmap of the tasks that have work.
+///\ingroup scheduler
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A scheduler that only calls tasks that have said that they have work.
+  /// A task calls task_set_ready() when it is given work, from any thread or
+  /// interrupt, which sets its bit in an atomic ready bitmap. The scheduler
+  /// finds the highest priority ready task with count_leading_zeros, checks
+  /// it with task_request_work() and calls task_process_work() once. The bit
+  /// stays set while the task reports more work.
+  /// Tasks without work are not called at all, so the cost of a pass does
+  /// not grow with the number of idle tasks.
+  /// Every task is marked as ready when the scheduler starts. Other threads
+  /// and interrupts should not call task_set_ready() until then, for example
+  /// until the first watchdog callback.
+  /// The idle callback is called when no task is ready, and may sleep until
+  /// an interrupt or another thread calls task_set_ready().
+  //***************************************************************************
+  template <size_t MAX_TASKS_>
+  class scheduler_event_driven : public etl::ischeduler, public etl::itask_ready_notifier
+  {
+  public:
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    scheduler_event_driven()
+      : ischeduler(task_list)
+    {
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        ready[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    //*******************************************
+    void start() ETL_OVERRIDE
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      for (size_t index = 0U; index < task_list.size(); ++index)
+      {
+        set_task_ready_notifier(*task_list[index], this, index);
+        task_ready(index);
+      }
+
+      scheduler_running = true;
+
+      while (!scheduler_exit)
+      {
+        if (scheduler_running)
+        {
+          bool idle = !run_highest_priority();
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Marks the task at 'index' as ready.
+    /// Called by etl::task::task_set_ready().
+    //*******************************************
+    void task_ready(size_t index) ETL_OVERRIDE
+    {
+      ready[index / Bits].fetch_or(bit(index), etl::memory_order_release);
+    }
+
+    //*******************************************
+    /// Returns true if any task is marked as ready.
+    /// May be used by the idle callback before sleeping.
+    //*******************************************
+    bool has_ready_tasks() const
+    {
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        if (ready[i].load(etl::memory_order_acquire) != 0U)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Bits  = 32U;
+    static ETL_CONSTANT size_t Words = (MAX_TASKS + Bits - 1U) / Bits;
+
+    //*******************************************
+    /// Tasks are in descending priority order, so index 0 is the top bit of
+    /// the first word, and the highest priority ready task is found with a
+    /// count of leading zeros.
+    //*******************************************
+    static uint32_t bit(size_t index)
+    {
+      return uint32_t(0x80000000UL) >> (index % Bits);
+    }
+
+    //*******************************************
+    /// Calls the highest priority ready task that has work.
+    /// Returns false if there were none.
+    //*******************************************
+    bool run_highest_priority()
+    {
+      for (size_t word = 0U; word < Words; ++word)
+      {
+        uint32_t bits = ready[word].load(etl::memory_order_acquire);
+
+        while (bits != 0U)
+        {
+          const size_t index = (word * Bits) + etl::count_leading_zeros(bits);
+
+          // Cleared before asking for work, so that a task_set_ready() from
+          // now on is not lost.
+          ready[word].fetch_and(~bit(index), etl::memory_order_acq_rel);
+
+          etl::task& task = *task_list[index];
+
+          if (task.task_request_work() > 0)
+          {
+            task.task_process_work();
+
+            if (task.task_request_work() > 0)
+            {
+              task_ready(index);
+            }
+
+            return true;
+          }
+
+          bits = ready[word].load(etl::memory_order_acquire);
+        }
+      }
+
+      return false;
+    }
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+    task_list_t task_list;
+
+    etl::atomic<uint32_t> ready[Words];
+  };
+}
+
+#endif
+#endif
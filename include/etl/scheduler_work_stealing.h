@@ -0,0 +1,390 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SCHEDULER_WORK_STEALING_INCLUDED
+#define ETL_SCHEDULER_WORK_STEALING_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "power.h"
+#include "static_assert.h"
+#include "vector.h"
+#include "task.h"
+#include "scheduler.h"
+
+///\defgroup scheduler_work_stealing Multi-threaded scheduler
+/// Runs tasks on several threads, each with its own deque of ready tasks.
+/// Requires the STL and C++11 for std::thread.
+///\ingroup scheduler
+
+#if ETL_USING_STL && ETL_CPP11_SUPPORTED && ETL_HAS_ATOMIC
+
+#include <thread>
+#include <vector>
+
+namespace etl
+{
+  namespace private_scheduler_work_stealing
+  {
+    //*************************************************************************
+    /// A Chase-Lev deque of task indexes.
+    /// The owning worker pushes and pops at the bottom. Other workers steal
+    /// from the top. SIZE must be a power of 2 and larger than the number of
+    /// indexes that may be in the deque at once.
+    //*************************************************************************
+    template <size_t SIZE>
+    class task_deque
+    {
+    public:
+
+      ETL_STATIC_ASSERT((SIZE & (SIZE - 1U)) == 0U, "SIZE must be a power of 2");
+
+      //*******************************
+      void clear()
+      {
+        top.store(0U, etl::memory_order_relaxed);
+        bottom.store(0U, etl::memory_order_relaxed);
+      }
+
+      //*******************************
+      /// Called by the owner.
+      //*******************************
+      void push(uint32_t index)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed);
+
+        slots[b & Mask].store(index, etl::memory_order_relaxed);
+        bottom.store(b + 1U, etl::memory_order_release);
+      }
+
+      //*******************************
+      /// Called by the owner.
+      /// Takes the most recently pushed index.
+      //*******************************
+      bool pop(uint32_t& index)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed) - 1U;
+        bottom.store(b, etl::memory_order_seq_cst);
+
+        uint32_t t = top.load(etl::memory_order_seq_cst);
+
+        const int32_t remaining = int32_t(b - t);
+
+        if (remaining < 0)
+        {
+          // Empty.
+          bottom.store(b + 1U, etl::memory_order_relaxed);
+          return false;
+        }
+
+        index = slots[b & Mask].load(etl::memory_order_relaxed);
+
+        if (remaining > 0)
+        {
+          return true;
+        }
+
+        // The last one, so race any thieves for it.
+        const bool taken = top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst, etl::memory_order_relaxed);
+        bottom.store(b + 1U, etl::memory_order_relaxed);
+
+        return taken;
+      }
+
+      //*******************************
+      /// Called by the other workers.
+      /// Takes the least recently pushed index.
+      //*******************************
+      bool steal(uint32_t& index)
+      {
+        uint32_t t = top.load(etl::memory_order_seq_cst);
+        const uint32_t b = bottom.load(etl::memory_order_seq_cst);
+
+        if (int32_t(b - t) <= 0)
+        {
+          return false;
+        }
+
+        index = slots[t & Mask].load(etl::memory_order_relaxed);
+
+        return top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst, etl::memory_order_relaxed);
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Mask = uint32_t(SIZE - 1U);
+
+      etl::atomic<uint32_t> top;
+      etl::atomic<uint32_t> bottom;
+      etl::atomic<uint32_t> slots[SIZE];
+    };
+  }
+
+  //***************************************************************************
+  /// A scheduler that runs tasks on N_WORKERS threads.
+  /// The thread that calls start() is worker 0 and the others are created by
+  /// start() and joined before it returns.
+  /// Tasks are shared between the workers in priority order. On each pass a
+  /// worker pushes its tasks that have work on to its deque and then calls
+  /// task_process_work() once for each, highest priority first. A worker that
+  /// runs out steals the lowest priority tasks from the other workers.
+  /// A task is only ever used by one thread at a time, but tasks that share
+  /// data with other tasks must synchronise access to it themselves.
+  /// The idle and watchdog callbacks are called from worker 0, which is the
+  /// only thread that may call exit_scheduler() or set_scheduler_running().
+  /// The scheduler is idle when no task is running and none has work.
+  //***************************************************************************
+  template <size_t MAX_TASKS_, size_t N_WORKERS_>
+  class scheduler_work_stealing : public etl::ischeduler
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N_WORKERS_ > 0U, "There must be at least one worker");
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+      N_WORKERS = N_WORKERS_
+    };
+
+    scheduler_work_stealing()
+      : ischeduler(task_list)
+    {
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    //*******************************************
+    void start() ETL_OVERRIDE
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      for (size_t i = 0U; i < MAX_TASKS; ++i)
+      {
+        claimed[i].store(false, etl::memory_order_relaxed);
+      }
+
+      for (size_t w = 0U; w < N_WORKERS; ++w)
+      {
+        deques[w].clear();
+      }
+
+      scheduler_running = true;
+      workers_running.store(true, etl::memory_order_relaxed);
+      workers_exit.store(false, etl::memory_order_relaxed);
+
+      std::vector<std::thread> threads;
+      threads.reserve(N_WORKERS - 1U);
+
+      for (size_t w = 1U; w < N_WORKERS; ++w)
+      {
+        threads.emplace_back([this, w]()
+                             {
+                               run_worker(w);
+                             });
+      }
+
+      while (!scheduler_exit)
+      {
+        workers_running.store(scheduler_running, etl::memory_order_release);
+
+        if (scheduler_running)
+        {
+          bool idle = !run_pass(0U);
+
+          if (idle)
+          {
+            idle = all_tasks_idle();
+          }
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+
+      workers_exit.store(true, etl::memory_order_release);
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+    }
+
+  private:
+
+    //*******************************************
+    /// The loop for workers 1 to N_WORKERS - 1.
+    //*******************************************
+    void run_worker(size_t worker)
+    {
+      while (!workers_exit.load(etl::memory_order_acquire))
+      {
+        if (!workers_running.load(etl::memory_order_acquire) || !run_pass(worker))
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    //*******************************************
+    /// Queues the worker's tasks that have work and runs them, stealing from
+    /// the other workers when the deque is empty.
+    /// Returns true if any work was done.
+    //*******************************************
+    bool run_pass(size_t worker)
+    {
+      queue_tasks(worker);
+
+      bool worked = false;
+      uint32_t index;
+
+      while (deques[worker].pop(index) || steal(worker, index))
+      {
+        task_list[index]->task_process_work();
+        claimed[index].store(false, etl::memory_order_release);
+        worked = true;
+      }
+
+      return worked;
+    }
+
+    //*******************************************
+    /// Worker 'w' looks after tasks w, w + N_WORKERS, w + (2 * N_WORKERS)...
+    /// They are pushed lowest priority first, so that the worker pops the
+    /// highest priority first and thieves steal the lowest.
+    //*******************************************
+    void queue_tasks(size_t worker)
+    {
+      if (worker >= task_list.size())
+      {
+        return;
+      }
+
+      size_t index = worker + (((task_list.size() - 1U - worker) / N_WORKERS) * N_WORKERS);
+
+      while (true)
+      {
+        if (claim(index))
+        {
+          if (task_list[index]->task_request_work() > 0)
+          {
+            deques[worker].push(uint32_t(index));
+          }
+          else
+          {
+            claimed[index].store(false, etl::memory_order_release);
+          }
+        }
+
+        if (index < N_WORKERS)
+        {
+          break;
+        }
+
+        index -= N_WORKERS;
+      }
+    }
+
+    //*******************************************
+    /// Tries to take a task from the other workers' deques.
+    //*******************************************
+    bool steal(size_t worker, uint32_t& index)
+    {
+      for (size_t i = 1U; i < N_WORKERS; ++i)
+      {
+        if (deques[(worker + i) % N_WORKERS].steal(index))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Checks every task, so that the idle callback is not called while
+    /// another worker is busy or has yet to queue a task with work.
+    //*******************************************
+    bool all_tasks_idle()
+    {
+      for (size_t index = 0U; index < task_list.size(); ++index)
+      {
+        if (!claim(index))
+        {
+          return false;
+        }
+
+        const bool has_work = (task_list[index]->task_request_work() > 0);
+
+        claimed[index].store(false, etl::memory_order_release);
+
+        if (has_work)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Only the worker that claims a task may use it until it is released.
+    //*******************************************
+    bool claim(size_t index)
+    {
+      bool expected = false;
+
+      return claimed[index].compare_exchange_strong(expected, true, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+    task_list_t task_list;
+
+    typedef private_scheduler_work_stealing::task_deque<etl::power_of_2_round_up<MAX_TASKS + 1U>::value> deque_t;
+    deque_t deques[N_WORKERS];
+
+    etl::atomic<bool> claimed[MAX_TASKS];
+    etl::atomic<bool> workers_running;
+    etl::atomic<bool> workers_exit;
+  };
+}
+
+#endif
+#endif
@@ -37,6 +37,8 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "type_traits.h"
+#include "private/string_search.h"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -491,20 +493,17 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_of(TIterator first, TIterator last, TPointer delimiters)
   {
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_t;
+
+    const private_string_search::character_set<char_t> set(delimiters, etl::strlen(delimiters));
+
     TIterator itr(first);
 
     while (itr != last)
     {
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
 
       ++itr;
@@ -537,26 +536,15 @@ namespace etl
   template <typename TIterator, typename TPointer>
   TIterator find_first_not_of(TIterator first, TIterator last, TPointer delimiters)
   {
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_t;
+
+    const private_string_search::character_set<char_t> set(delimiters, etl::strlen(delimiters));
+
     TIterator itr(first);
 
     while (itr != last)
     {
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -596,6 +584,10 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_t;
+
+    const private_string_search::character_set<char_t> set(delimiters, etl::strlen(delimiters));
+
     TIterator itr(last);
     TIterator end(first);
 
@@ -603,16 +595,9 @@ namespace etl
     {
       --itr;
 
-      TPointer pd = delimiters;
-
-      while (*pd != 0)
+      if (set.contains(*itr))
       {
-        if (*itr == *pd)
-        {
-          return itr;
-        }
-
-        ++pd;
+        return itr;
       }
     } while (itr != end);
 
@@ -648,6 +633,10 @@ namespace etl
       return last;
     }
 
+    typedef typename etl::remove_cv<typename etl::remove_pointer<TPointer>::type>::type char_t;
+
+    const private_string_search::character_set<char_t> set(delimiters, etl::strlen(delimiters));
+
     TIterator itr(last);
     TIterator end(first);
 
@@ -655,22 +644,7 @@ namespace etl
     {
       --itr;
 
-      TPointer pd = delimiters;
-
-      bool found = false;
-
-      while (*pd != 0)
-      {
-        if (*itr == *pd)
-        {
-          found = true;
-          break;
-        }
-
-        ++pd;
-      }
-
-      if (!found)
+      if (!set.contains(*itr))
       {
         return itr;
       }
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.h"
 #include "basic_string.h"
 #include "algorithm.h"
+#include "private/string_search.h"
 
 #include "stdint.h"
 
@@ -406,7 +407,16 @@ namespace etl
     //*************************************************************************
     int compare(basic_string_view<T, TTraits> view) const
     {
-      return (*this == view) ? 0 : ((*this > view) ? 1 : -1);
+      const size_type length = etl::min(size(), view.size());
+
+      const size_type i = private_string_search::mismatch(mbegin, view.mbegin, length);
+
+      if (i != length)
+      {
+        return (mbegin[i] < view.mbegin[i]) ? -1 : 1;
+      }
+
+      return (size() == view.size()) ? 0 : ((size() < view.size()) ? -1 : 1);
     }
 
     int compare(size_type position, size_type count, basic_string_view view) const
@@ -486,21 +496,12 @@ namespace etl
     //*************************************************************************
     size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if ((position > size()) || ((size() - position) < view.size()))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return to_position(private_string_search::search(mbegin + position, mend, view.mbegin, view.size()));
     }
 
     size_type find(T c, size_type position = 0) const
@@ -565,22 +566,9 @@ namespace etl
     //*************************************************************************
     size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
+        return to_position(private_string_search::find_first_of(mbegin + position, mend, view.mbegin, view.size()));
       }
 
       return npos;
@@ -613,25 +601,10 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
+      const T* last = mbegin + position + 1;
+      const T* p    = private_string_search::find_last_of(mbegin, last, view.mbegin, view.size());
 
-      return npos;
+      return (p == last) ? npos : size_type(p - mbegin);
     }
 
     size_type find_last_of(T c, size_type position = npos) const
@@ -654,29 +627,9 @@ namespace etl
     //*************************************************************************
     size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return to_position(private_string_search::find_first_not_of(mbegin + position, mend, view.mbegin, view.size()));
       }
 
       return npos;
@@ -709,32 +662,10 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
+      const T* last = mbegin + position + 1;
+      const T* p    = private_string_search::find_last_not_of(mbegin, last, view.mbegin, view.size());
 
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p == last) ? npos : size_type(p - mbegin);
     }
 
     size_type find_last_not_of(T c, size_type position = npos) const
@@ -758,7 +689,7 @@ namespace etl
     friend bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
       return (lhs.size() == rhs.size()) &&
-        etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+        (private_string_search::mismatch(lhs.mbegin, rhs.mbegin, lhs.size()) == lhs.size());
     }
 
     //*************************************************************************
@@ -774,7 +705,7 @@ namespace etl
     //*************************************************************************
     friend bool operator < (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
-      return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+      return lhs.compare(rhs) < 0;
     }
 
     //*************************************************************************
@@ -803,6 +734,14 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// The position of a search result, or npos if it is the end.
+    //*************************************************************************
+    size_type to_position(const T* p) const
+    {
+      return (p == mend) ? npos : size_type(p - mbegin);
+    }
+
     const T* mbegin;
     const T* mend;
   };
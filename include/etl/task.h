@@ -29,11 +29,13 @@ SOFTWARE.
 #ifndef ETL_TASK_INCLUDED
 #define ETL_TASK_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "platform.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "nullptr.h"
 
 namespace etl
 {
@@ -52,6 +54,28 @@ namespace etl
 
   typedef uint_least8_t task_priority_t;
 
+  class ischeduler;
+
+  //***************************************************************************
+  /// Interface for schedulers that are told when a task has work, rather
+  /// than asking every task.
+  //***************************************************************************
+  class itask_ready_notifier
+  {
+  public:
+
+    //*******************************************
+    /// Called when the task at 'index' has work.
+    //*******************************************
+    virtual void task_ready(size_t index) = 0;
+
+  protected:
+
+    ~itask_ready_notifier()
+    {
+    }
+  };
+
   //***************************************************************************
   /// Task.
   //***************************************************************************
@@ -64,7 +88,9 @@ namespace etl
     //*******************************************
     task(task_priority_t priority)
       : task_running(true),
-        task_priority(priority)
+        task_priority(priority),
+        p_ready_notifier(ETL_NULLPTR),
+        ready_index(0U)
     {
     }
 
@@ -119,10 +145,27 @@ namespace etl
       return task_priority;
     }
 
+    //*******************************************
+    /// Tells an event driven scheduler that the task has work.
+    /// Does nothing for the other schedulers.
+    /// May be called from any thread or interrupt.
+    //*******************************************
+    void task_set_ready()
+    {
+      if (p_ready_notifier != ETL_NULLPTR)
+      {
+        p_ready_notifier->task_ready(ready_index);
+      }
+    }
+
   private:
 
+    friend class etl::ischeduler;
+
     bool task_running;
     etl::task_priority_t task_priority;
+    etl::itask_ready_notifier* p_ready_notifier;
+    size_t ready_index;
   };
 }
 
@@ -96,6 +96,23 @@ namespace etl
       };
     };
   };
+
+  //***************************************************************************
+  /// Common definitions for the timing wheel timers.
+  //***************************************************************************
+  struct timer_wheel
+  {
+    // Timer id.
+    struct id
+    {
+      enum
+      {
+        NO_TIMER = 0xFFFFU
+      };
+
+      typedef uint_least16_t type;
+    };
+  };
 }
 
 #endif
@@ -0,0 +1,665 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_TO_ARITHMETIC_INCLUDED
+#define ETL_TO_ARITHMETIC_INCLUDED
+
+///\ingroup string
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "binary.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "private/eisel_lemire.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a conversion from text.
+  //***************************************************************************
+  struct to_arithmetic_status
+  {
+    enum enum_type
+    {
+      Valid,
+      Invalid_Format, ///< No digits, or unused characters after them.
+      Invalid_Radix,  ///< The radix is not 2 to 36, or not 10 for floating point.
+      Overflow        ///< The value is too large for the type.
+    };
+  };
+
+  //***************************************************************************
+  /// The result of etl::from_chars.
+  /// 'ptr' is the first character that was not used.
+  //***************************************************************************
+  template <typename TChar>
+  struct from_chars_result
+  {
+    const TChar*                         ptr;
+    etl::to_arithmetic_status::enum_type status;
+  };
+
+  //***************************************************************************
+  /// The result of etl::to_arithmetic.
+  /// Either a value or the reason that there isn't one.
+  //***************************************************************************
+  template <typename T>
+  class to_arithmetic_result
+  {
+  public:
+
+    typedef T                                    value_type;
+    typedef etl::to_arithmetic_status::enum_type error_type;
+
+    //*******************************
+    to_arithmetic_result(T value__, error_type status_)
+      : value_(value__)
+      , status(status_)
+    {
+    }
+
+    //*******************************
+    bool has_value() const
+    {
+      return status == etl::to_arithmetic_status::Valid;
+    }
+
+    //*******************************
+    ETL_EXPLICIT operator bool() const
+    {
+      return has_value();
+    }
+
+    //*******************************
+    /// Undefined if has_value() is false.
+    //*******************************
+    T value() const
+    {
+      return value_;
+    }
+
+    //*******************************
+    T value_or(T default_value) const
+    {
+      return has_value() ? value_ : default_value;
+    }
+
+    //*******************************
+    error_type error() const
+    {
+      return status;
+    }
+
+  private:
+
+    T          value_;
+    error_type status;
+  };
+
+  namespace private_to_arithmetic
+  {
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t accumulator_type;
+#else
+    typedef uint32_t accumulator_type;
+#endif
+
+    static ETL_CONSTANT uint32_t Not_A_Digit = 255U;
+
+    //*************************************************************************
+    /// The value of a digit in any radix up to 36, or Not_A_Digit.
+    //*************************************************************************
+    template <typename TChar>
+    uint32_t digit_value(TChar c)
+    {
+      if ((c >= TChar('0')) && (c <= TChar('9')))
+      {
+        return uint32_t(c - TChar('0'));
+      }
+      else if ((c >= TChar('a')) && (c <= TChar('z')))
+      {
+        return uint32_t(c - TChar('a')) + 10U;
+      }
+      else if ((c >= TChar('A')) && (c <= TChar('Z')))
+      {
+        return uint32_t(c - TChar('A')) + 10U;
+      }
+      else
+      {
+        return Not_A_Digit;
+      }
+    }
+
+    //*************************************************************************
+    template <typename TChar>
+    bool is_decimal_digit(TChar c)
+    {
+      return (c >= TChar('0')) && (c <= TChar('9'));
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Eight digits at a time is only possible for single byte characters.
+    //*************************************************************************
+    template <typename TChar>
+    bool parse_eight_digits(const TChar*, uint32_t&)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// Converts eight decimal characters at once, if they are all digits.
+    /// The characters are loaded as a little endian word, so that the first
+    /// is in the lowest byte, whatever the endianness of the platform.
+    //*************************************************************************
+    inline bool parse_eight_digits(const char* p, uint32_t& value)
+    {
+      uint64_t word;
+
+#if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(_MSC_VER)
+      memcpy(&word, p, sizeof(word));
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+      memcpy(&word, p, sizeof(word));
+      word = etl::reverse_bytes(word);
+#else
+      word = 0U;
+
+      for (int i = 7; i >= 0; --i)
+      {
+        word = (word << 8U) | uint8_t(p[i]);
+      }
+#endif
+
+      // Each byte is a digit if it is 0x30 to 0x39, which is when neither
+      // adding 0x46 nor subtracting 0x30 sets its top bit.
+      if ((((word + 0x4646464646464646ULL) | (word - 0x3030303030303030ULL)) & 0x8080808080808080ULL) != 0U)
+      {
+        return false;
+      }
+
+      // Combine pairs of digits, then pairs of pairs, then the two halves.
+      word -= 0x3030303030303030ULL;
+      word  = (word * 10U) + (word >> 8U);
+      word  = (((word & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+               (((word >> 16U) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32U;
+
+      value = uint32_t(word);
+
+      return true;
+    }
+#endif
+
+    //*************************************************************************
+    /// Accumulates the digits at 'p' as long as the value does not exceed
+    /// 'limit'. The digits after an overflow are used, but not accumulated.
+    /// Returns the first character that is not a digit.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* parse_integral_digits(const TChar* p, const TChar* last, uint32_t radix, accumulator_type limit, accumulator_type& value, bool& overflow)
+    {
+      value    = 0U;
+      overflow = false;
+
+#if ETL_USING_64BIT_TYPES
+      // Eight digits at a time while the result is certain to be in range.
+      if ((radix == 10U) && (limit >= 99999999U))
+      {
+        const accumulator_type max_before_eight = (limit - 99999999U) / 100000000U;
+
+        uint32_t eight;
+
+        while ((value <= max_before_eight) && ((last - p) >= 8) && parse_eight_digits(p, eight))
+        {
+          value = (value * 100000000U) + eight;
+          p += 8;
+        }
+      }
+#endif
+
+      const accumulator_type max_before_multiply = limit / radix;
+      const uint32_t         max_last_digit      = uint32_t(limit % radix);
+
+      while (p != last)
+      {
+        const uint32_t digit = digit_value(*p);
+
+        if (digit >= radix)
+        {
+          break;
+        }
+
+        if (!overflow)
+        {
+          if ((value > max_before_multiply) || ((value == max_before_multiply) && (digit > max_last_digit)))
+          {
+            overflow = true;
+          }
+          else
+          {
+            value = (value * radix) + digit;
+          }
+        }
+
+        ++p;
+      }
+
+      return p;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Accumulates decimal digits, modulo 2^64.
+    /// Returns the first character that is not a digit.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* parse_decimal_digits(const TChar* p, const TChar* last, uint64_t& value)
+    {
+      uint32_t eight;
+
+      while (((last - p) >= 8) && parse_eight_digits(p, eight))
+      {
+        value = (value * 100000000U) + eight;
+        p += 8;
+      }
+
+      while ((p != last) && is_decimal_digit(*p))
+      {
+        value = (value * 10U) + uint64_t(*p - TChar('0'));
+        ++p;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Matches a lower case word, ignoring the case of the text.
+    //*************************************************************************
+    template <typename TChar>
+    bool match_word(const TChar* p, const TChar* last, const char* word)
+    {
+      while (*word != '\0')
+      {
+        if ((p == last) || ((*p != TChar(*word)) && (*p != TChar(*word - ('a' - 'A')))))
+        {
+          return false;
+        }
+
+        ++p;
+        ++word;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Parses "inf", "infinity" or "nan", ignoring case.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::from_chars_result<TChar> parse_special(const TChar* first, const TChar* p, const TChar* last, bool negative, T& value)
+    {
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type float_t;
+      typedef private_eisel_lemire::float_traits<float_t> traits;
+
+      etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Invalid_Format };
+
+      private_eisel_lemire::adjusted_mantissa am;
+      am.power2 = traits::Infinite_Power;
+
+      if (match_word(p, last, "nan"))
+      {
+        // A quiet NaN.
+        am.mantissa = uint64_t(1U) << (traits::Mantissa_Bits - 1);
+        result.ptr  = p + 3;
+      }
+      else if (match_word(p, last, "infinity"))
+      {
+        result.ptr = p + 8;
+      }
+      else if (match_word(p, last, "inf"))
+      {
+        result.ptr = p + 3;
+      }
+      else
+      {
+        return result;
+      }
+
+      value         = T(private_eisel_lemire::to_float<float_t>(negative, am));
+      result.status = etl::to_arithmetic_status::Valid;
+
+      return result;
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Converts the text in [first, last) to an integral value.
+  /// Like std::from_chars, there may be a leading '-' for signed types, but
+  /// no '+', whitespace or radix prefix. Letters are used for the digits
+  /// above 9, in either case.
+  /// 'value' is only changed if the status is Valid.
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value, int radix = 10)
+  {
+    using namespace private_to_arithmetic;
+
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Invalid_Format };
+
+    if ((radix < 2) || (radix > 36))
+    {
+      result.status = etl::to_arithmetic_status::Invalid_Radix;
+      return result;
+    }
+
+    const TChar* p        = first;
+    bool         negative = false;
+
+    if (etl::is_signed<T>::value && (p != last) && (*p == TChar('-')))
+    {
+      negative = true;
+      ++p;
+    }
+
+    // The magnitude of the minimum is one more than the maximum.
+    const accumulator_type limit = accumulator_type(etl::integral_limits<T>::max) + (negative ? 1U : 0U);
+
+    accumulator_type magnitude;
+    bool             overflow;
+
+    // Decimal is by far the most common, so give it constant divisors.
+    const TChar* end = (radix == 10) ? parse_integral_digits(p, last, 10U, limit, magnitude, overflow)
+                                     : parse_integral_digits(p, last, uint32_t(radix), limit, magnitude, overflow);
+
+    if (end == p)
+    {
+      return result;
+    }
+
+    result.ptr = end;
+
+    if (overflow)
+    {
+      result.status = etl::to_arithmetic_status::Overflow;
+      return result;
+    }
+
+    value         = negative ? T(unsigned_t(0U) - unsigned_t(magnitude)) : T(magnitude);
+    result.status = etl::to_arithmetic_status::Valid;
+
+    return result;
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Converts the text in [first, last) to a floating point value, correctly
+  /// rounded to nearest, ties to even.
+  /// Like std::from_chars, there may be a leading '-', but no '+' or
+  /// whitespace. Accepts decimal and exponent forms, "inf", "infinity" and
+  /// "nan", ignoring case. Hexadecimal forms are not supported.
+  /// Values too small for the type are rounded to zero. Values too large
+  /// are an Overflow. long double is converted with the precision of double.
+  /// 'value' is only changed if the status is Valid.
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value)
+  {
+    using namespace private_to_arithmetic;
+
+    typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type float_t;
+    typedef private_eisel_lemire::float_traits<float_t> traits;
+
+    static ETL_CONSTANT int Max_Fast_Digits = 19; // The most that are certain to fit in 64 bits.
+
+    etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Invalid_Format };
+
+    const TChar* p        = first;
+    bool         negative = false;
+
+    if ((p != last) && (*p == TChar('-')))
+    {
+      negative = true;
+      ++p;
+    }
+
+    if ((p == last) || (!is_decimal_digit(*p) && (*p != TChar('.'))))
+    {
+      return parse_special(first, p, last, negative, value);
+    }
+
+    // The significand.
+    uint64_t w = 0U;
+
+    const TChar* const first_digit = p;
+
+    p = parse_decimal_digits(p, last, w);
+
+    int digit_count     = int(p - first_digit);
+    int fraction_digits = 0;
+
+    if ((p != last) && (*p == TChar('.')))
+    {
+      ++p;
+
+      const TChar* const first_fraction_digit = p;
+
+      p = parse_decimal_digits(p, last, w);
+
+      fraction_digits = int(p - first_fraction_digit);
+      digit_count    += fraction_digits;
+    }
+
+    if (digit_count == 0)
+    {
+      return result;
+    }
+
+    const TChar* const last_digit = p;
+
+    // The exponent is only used if it has digits.
+    int exponent_number = 0;
+
+    if ((p != last) && ((*p == TChar('e')) || (*p == TChar('E'))))
+    {
+      const TChar* e = p + 1;
+      bool negative_exponent = false;
+
+      if ((e != last) && ((*e == TChar('-')) || (*e == TChar('+'))))
+      {
+        negative_exponent = (*e == TChar('-'));
+        ++e;
+      }
+
+      if ((e != last) && is_decimal_digit(*e))
+      {
+        while ((e != last) && is_decimal_digit(*e))
+        {
+          // Far beyond any representable value, so stop before int overflows.
+          if (exponent_number < 0x10000)
+          {
+            exponent_number = (exponent_number * 10) + int(*e - TChar('0'));
+          }
+
+          ++e;
+        }
+
+        exponent_number = negative_exponent ? -exponent_number : exponent_number;
+        p = e;
+      }
+    }
+
+    result.ptr = p;
+
+    int  exponent = exponent_number - fraction_digits;
+    bool truncated = false;
+
+    if (digit_count > Max_Fast_Digits)
+    {
+      // Leading zeros are not significant.
+      const TChar* s = first_digit;
+
+      while ((s != last_digit) && ((*s == TChar('0')) || (*s == TChar('.'))))
+      {
+        if (*s == TChar('0'))
+        {
+          --digit_count;
+        }
+
+        ++s;
+      }
+
+      if (digit_count > Max_Fast_Digits)
+      {
+        // Use the leading digits and scale by the number left over.
+        truncated = true;
+        w         = 0U;
+
+        for (int taken = 0; taken < Max_Fast_Digits; ++s)
+        {
+          if (*s != TChar('.'))
+          {
+            w = (w * 10U) + uint64_t(*s - TChar('0'));
+            ++taken;
+          }
+        }
+
+        exponent += digit_count - Max_Fast_Digits;
+      }
+    }
+
+    private_eisel_lemire::adjusted_mantissa am = private_eisel_lemire::compute_float<float_t>(exponent, w);
+
+    if (truncated && (am != private_eisel_lemire::compute_float<float_t>(exponent, w + 1U)))
+    {
+      // The digits that were left over decide it.
+      am = private_eisel_lemire::compare_digits<float_t>(first_digit, last_digit, exponent_number - fraction_digits, am);
+    }
+
+    if (am.power2 == traits::Infinite_Power)
+    {
+      result.status = etl::to_arithmetic_status::Overflow;
+      return result;
+    }
+
+    value         = T(private_eisel_lemire::to_float<float_t>(negative, am));
+    result.status = etl::to_arithmetic_status::Valid;
+
+    return result;
+  }
+#endif
+
+  namespace private_to_arithmetic
+  {
+    //*************************************************************************
+    template <typename T, typename TChar>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::from_chars_result<TChar> >::type
+      parse(const TChar* first, const TChar* last, T& value, int radix)
+    {
+      return etl::from_chars(first, last, value, radix);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    template <typename T, typename TChar>
+    typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+      parse(const TChar* first, const TChar* last, T& value, int radix)
+    {
+      if (radix != 10)
+      {
+        etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Invalid_Radix };
+        return result;
+      }
+
+      return etl::from_chars(first, last, value);
+    }
+#endif
+
+    //*************************************************************************
+    /// All of the text must be used.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::to_arithmetic_result<T> to_arithmetic(const TChar* first, const TChar* last, int radix)
+    {
+      T value = T(0);
+
+      const etl::from_chars_result<TChar> result = parse(first, last, value, radix);
+
+      if ((result.status == etl::to_arithmetic_status::Valid) && (result.ptr != last))
+      {
+        return etl::to_arithmetic_result<T>(T(0), etl::to_arithmetic_status::Invalid_Format);
+      }
+
+      return etl::to_arithmetic_result<T>(value, result.status);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts text to an arithmetic value, using all of the characters.
+  /// The formats are those of etl::from_chars.
+  //***************************************************************************
+  template <typename T, typename TChar>
+  etl::to_arithmetic_result<T> to_arithmetic(const TChar* str, size_t length, int radix = 10)
+  {
+    return private_to_arithmetic::to_arithmetic<T>(str, str + length, radix);
+  }
+
+  //***************************************************************************
+  /// Converts text to an arithmetic value, using all of the characters.
+  /// The formats are those of etl::from_chars.
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits>
+  etl::to_arithmetic_result<T> to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view, int radix = 10)
+  {
+    return private_to_arithmetic::to_arithmetic<T>(view.data(), view.data() + view.size(), radix);
+  }
+
+  //***************************************************************************
+  /// Converts text to an arithmetic value, using all of the characters.
+  /// The formats are those of etl::from_chars.
+  //***************************************************************************
+  template <typename T, typename TChar>
+  etl::to_arithmetic_result<T> to_arithmetic(const etl::ibasic_string<TChar>& str, int radix = 10)
+  {
+    return private_to_arithmetic::to_arithmetic<T>(str.data(), str.data() + str.size(), radix);
+  }
+}
+
+#endif
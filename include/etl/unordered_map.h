@@ -42,6 +42,7 @@ SOFTWARE.
 #include "pool.h"
 #include "array.h"
 #include "intrusive_forward_list.h"
+#include "bitset.h"
 #include "hash.h"
 #include "type_traits.h"
 #include "parameter_type.h"
@@ -52,6 +53,7 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 #include "placement_new.h"
+#include "private/comparator_is_transparent.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -198,7 +200,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -212,15 +214,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Skip straight to the next occupied bucket.
+          pbucket = pmap->find_next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pmap->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -240,7 +238,7 @@ namespace etl
       //*********************************
       iterator& operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pmap = other.pmap;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -279,8 +277,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      iterator(const iunordered_map* pmap_, bucket_t* pbucket_, local_iterator inode_)
+        : pmap(pmap_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -310,7 +308,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const iunordered_map* pmap;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -341,7 +339,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_map::iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
           pbucket(other.pbucket),
           inode(other.inode)
       {
@@ -349,7 +347,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
           pbucket(other.pbucket),
           inode(other.inode)
       {
@@ -363,15 +361,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Skip straight to the next occupied bucket.
+          pbucket = pmap->find_next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pmap->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -391,7 +385,7 @@ namespace etl
       //*********************************
       const_iterator& operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pmap = other.pmap;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -430,8 +424,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      const_iterator(const iunordered_map* pmap_, bucket_t* pbucket_, local_iterator inode_)
+        : pmap(pmap_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -461,7 +455,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const iunordered_map* pmap;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -474,7 +468,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -483,7 +477,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -492,7 +486,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -528,7 +522,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -537,7 +531,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -546,7 +540,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -585,6 +579,18 @@ namespace etl
       return key_hash_function(key) % number_of_buckets;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns the bucket index for the key, for transparent hashers and key comparators.
+    ///\return The bucket index for the key.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+#endif
+
     //*********************************************************************
     /// Returns the size of the bucket key.
     ///\return The bucket size of the bucket key.
@@ -650,7 +656,7 @@ namespace etl
 
       pbucket->insert_after(pbucket->before_begin(), node);
 
-      adjust_first_last_markers_after_insert(pbucket);
+      adjust_occupancy_after_insert(pbucket);
 
       return pbucket->begin()->key_value_pair.second;
     }
@@ -780,9 +786,9 @@ namespace etl
         // Just add the pointer to the bucket;
         bucket.insert_after(bucket.before_begin(), node);
 
-        adjust_first_last_markers_after_insert(pbucket);
+        adjust_occupancy_after_insert(pbucket);
 
-        result.first = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result.first = iterator(this, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -813,10 +819,10 @@ namespace etl
 
           // Add the node to the end of the bucket;
           bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
+          adjust_occupancy_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+          result.first = iterator(this, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -856,9 +862,9 @@ namespace etl
           // Just add the pointer to the bucket;
           bucket.insert_after(bucket.before_begin(), node);
 
-        adjust_first_last_markers_after_insert(pbucket);
+        adjust_occupancy_after_insert(pbucket);
 
-        result.first = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result.first = iterator(this, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -889,10 +895,10 @@ namespace etl
 
             // Add the node to the end of the bucket;
             bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
+          adjust_occupancy_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+          result.first = iterator(this, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -969,7 +975,7 @@ namespace etl
         bucket.erase_after(iprevious);          // Unlink from the bucket.
         icurrent->key_value_pair.~value_type(); // Destroy the value.
         pnodepool->release(&*icurrent);         // Release it back to the pool.
-        adjust_first_last_markers_after_erase(&bucket);
+        adjust_occupancy_after_erase(&bucket);
         n = 1;
         ETL_DECREMENT_DEBUG_COUNT
       }
@@ -984,7 +990,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(this, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -1000,7 +1006,7 @@ namespace etl
       bucket.erase_after(iprevious);          // Unlink from the bucket.
       icurrent->key_value_pair.~value_type(); // Destroy the value.
       pnodepool->release(&*icurrent);         // Release it back to the pool.
-      adjust_first_last_markers_after_erase(&bucket);
+      adjust_occupancy_after_erase(&bucket);
       ETL_DECREMENT_DEBUG_COUNT
 
       return inext;
@@ -1041,7 +1047,7 @@ namespace etl
         local_iterator inext = pbucket->erase_after(iprevious); // Unlink from the bucket.
         icurrent->key_value_pair.~value_type(); // Destroy the value.
         pnodepool->release(&*icurrent);         // Release it back to the pool.
-        adjust_first_last_markers_after_erase(pbucket);
+        adjust_occupancy_after_erase(pbucket);
         ETL_DECREMENT_DEBUG_COUNT
 
         icurrent = inext;
@@ -1053,18 +1059,18 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = find_next_occupied_bucket(pbucket);
 
-            iprevious = pbucket->before_begin();
-            icurrent  = pbucket->begin();
+            if (pbucket != end_bucket())
+            {
+              iprevious = pbucket->before_begin();
+              icurrent  = pbucket->begin();
+            }
           }
         }
       }
 
-      return iterator((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      return iterator(this, last_.get_bucket_list_iterator(), last_.get_local_iterator());
     }
 
     //*************************************************************************
@@ -1085,6 +1091,19 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1109,7 +1128,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1143,7 +1162,43 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1153,6 +1208,42 @@ namespace etl
       return end();
     }
 
+    //*********************************************************************
+    /// Finds an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return iterator(this, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1195,6 +1286,52 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_map.
     //*************************************************************************
@@ -1305,10 +1442,11 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+    iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::ibitset& occupied_)
       : pnodepool(&node_pool_),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        poccupied(&occupied_)
     {
     }
 
@@ -1348,7 +1486,7 @@ namespace etl
       }
 
       first = pbuckets;
-      last = first;
+      poccupied->reset();
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -1376,71 +1514,51 @@ namespace etl
     }
 
     //*********************************************************************
-    /// Adjust the first and last markers according to the new entry.
+    /// Mark the bucket as occupied and adjust the first marker according to the new entry.
     //*********************************************************************
-    void adjust_first_last_markers_after_insert(bucket_t* pbucket)
+    void adjust_occupancy_after_insert(bucket_t* pbucket)
     {
-      if (size() == 1)
+      poccupied->set(size_t(pbucket - pbuckets));
+
+      if ((size() == 1) || (pbucket < first))
       {
         first = pbucket;
-        last  = pbucket;
-      }
-      else
-      {
-        if (pbucket < first)
-        {
-          first = pbucket;
-        }
-        else if (pbucket > last)
-        {
-          last = pbucket;
-        }
       }
     }
 
     //*********************************************************************
-    /// Adjust the first and last markers according to the erased entry.
+    /// Mark the bucket as unoccupied if the erase emptied it, and adjust the first marker.
     //*********************************************************************
-    void adjust_first_last_markers_after_erase(bucket_t* pbucket)
+    void adjust_occupancy_after_erase(bucket_t* pbucket)
     {
-      if (empty())
-      {
-        first = pbuckets;
-        last  = pbuckets;
-      }
-      else
+      if (pbucket->empty())
       {
+        poccupied->reset(size_t(pbucket - pbuckets));
+
+        // We emptied the first, so search the bitmap for the next one.
         if (pbucket == first)
         {
-          // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = empty() ? pbuckets : find_next_occupied_bucket(pbucket);
         }
-        else if (pbucket == last)
-        {
-          // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pcurrent = first;
-          bucket_t* pend = last;
+      }
+    }
 
-          last = first;
+    //*********************************************************************
+    /// Finds the next occupied bucket after pbucket, or end_bucket() if there are none.
+    //*********************************************************************
+    bucket_t* find_next_occupied_bucket(const bucket_t* pbucket) const
+    {
+      size_t index = poccupied->find_next(true, size_t(pbucket - pbuckets) + 1U);
 
-          while (pcurrent != pend)
-          {
-            if (!pcurrent->empty())
-            {
-              last = pcurrent;
-            }
+      return (index == etl::ibitset::npos) ? end_bucket() : pbuckets + index;
+    }
 
-            ++pcurrent;
-          }
-        }
-        else
-        {
-          // Nothing to do.
-        }
-      }
+    //*********************************************************************
+    /// Gets the bucket past the last one.
+    //*********************************************************************
+    bucket_t* end_bucket() const
+    {
+      return pbuckets + number_of_buckets;
     }
 
     // Disable copy construction.
@@ -1455,9 +1573,11 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
-    /// The first and last pointers to buckets with values.
+    /// The bitmap of buckets with values.
+    etl::ibitset* poccupied;
+
+    /// The pointer to the first bucket with values.
     bucket_t* first;
-    bucket_t* last;
 
     /// The function that creates the hashes.
     hasher key_hash_function;
@@ -1529,7 +1649,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_map()
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
     {
       base::initialise();
     }
@@ -1538,7 +1658,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -1548,7 +1668,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_map(unordered_map&& other)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
     {
       if (this != &other)
       {
@@ -1565,7 +1685,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
     {
       base::assign(first_, last_);
     }
@@ -1575,7 +1695,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1627,6 +1747,9 @@ namespace etl
 
     /// The buckets of node lists.
     etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The bitmap of buckets with values.
+    etl::bitset<MAX_BUCKETS_> occupied;
   };
 
   //*************************************************************************
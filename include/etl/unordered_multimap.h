@@ -42,6 +42,7 @@ SOFTWARE.
 #include "pool.h"
 #include "vector.h"
 #include "intrusive_forward_list.h"
+#include "bitset.h"
 #include "hash.h"
 #include "type_traits.h"
 #include "parameter_type.h"
@@ -52,6 +53,7 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 #include "placement_new.h"
+#include "private/comparator_is_transparent.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -196,7 +198,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -210,15 +212,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Skip straight to the next occupied bucket.
+          pbucket = pmap->find_next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pmap->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -238,7 +236,7 @@ namespace etl
       //*********************************
       iterator& operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pmap = other.pmap;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -277,8 +275,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      iterator(const iunordered_multimap* pmap_, bucket_t* pbucket_, local_iterator inode_)
+        : pmap(pmap_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -308,7 +306,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const iunordered_multimap* pmap;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -339,7 +337,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_multimap::iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -347,7 +345,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -361,16 +359,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Skip straight to the next occupied bucket.
+          pbucket = pmap->find_next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pmap->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -390,7 +383,7 @@ namespace etl
       //*********************************
       const_iterator& operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pmap = other.pmap;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -429,8 +422,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      const_iterator(const iunordered_multimap* pmap_, bucket_t* pbucket_, local_iterator inode_)
+        : pmap(pmap_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -460,7 +453,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const iunordered_multimap* pmap;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -473,7 +466,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -482,7 +475,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -491,7 +484,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -527,7 +520,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -536,7 +529,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -545,7 +538,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -584,6 +577,18 @@ namespace etl
       return key_hash_function(key) % number_of_buckets;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns the bucket index for the key, for transparent hashers and key comparators.
+    ///\return The bucket index for the key.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+#endif
+
     //*********************************************************************
     /// Returns the size of the bucket key.
     ///\return The bucket size of the bucket key.
@@ -667,9 +672,9 @@ namespace etl
 
         // Just add the pointer to the bucket;
         bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(pbucket);
+        adjust_occupancy_after_insert(pbucket);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result = iterator(this, pbucket, pbucket->begin());
       }
       else
       {
@@ -696,10 +701,10 @@ namespace etl
 
         // Add the node to the end of the bucket;
         bucket.insert_after(inode_previous, node);
-        adjust_first_last_markers_after_insert(&bucket);
+        adjust_occupancy_after_insert(&bucket);
         ++inode_previous;
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+        result = iterator(this, pbucket, inode_previous);
       }
 
       return result;
@@ -736,9 +741,9 @@ namespace etl
 
           // Just add the pointer to the bucket;
           bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(pbucket);
+        adjust_occupancy_after_insert(pbucket);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result = iterator(this, pbucket, pbucket->begin());
       }
       else
       {
@@ -765,10 +770,10 @@ namespace etl
 
           // Add the node to the end of the bucket;
           bucket.insert_after(inode_previous, node);
-        adjust_first_last_markers_after_insert(&bucket);
+        adjust_occupancy_after_insert(&bucket);
         ++inode_previous;
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+        result = iterator(this, pbucket, inode_previous);
       }
 
       return result;
@@ -837,7 +842,7 @@ namespace etl
           bucket.erase_after(iprevious);          // Unlink from the bucket.
           icurrent->key_value_pair.~value_type(); // Destroy the value.
           pnodepool->release(&*icurrent);         // Release it back to the pool.
-          adjust_first_last_markers_after_erase(&bucket);
+          adjust_occupancy_after_erase(&bucket);
           ++n;
           icurrent = iprevious;
           ETL_DECREMENT_DEBUG_COUNT
@@ -860,7 +865,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(this, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -876,7 +881,7 @@ namespace etl
       bucket.erase_after(iprevious);          // Unlink from the bucket.
       icurrent->key_value_pair.~value_type(); // Destroy the value.
       pnodepool->release(&*icurrent);         // Release it back to the pool.
-      adjust_first_last_markers_after_erase(&bucket);
+      adjust_occupancy_after_erase(&bucket);
       ETL_DECREMENT_DEBUG_COUNT
 
       return inext;
@@ -899,7 +904,7 @@ namespace etl
       }
 
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(this, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket     = first_.get_bucket_list_iterator();
@@ -921,7 +926,7 @@ namespace etl
         local_iterator inext = pbucket->erase_after(iprevious); // Unlink from the bucket.
         icurrent->key_value_pair.~value_type(); // Destroy the value.
         pnodepool->release(&*icurrent);         // Release it back to the pool.
-        adjust_first_last_markers_after_erase(pbucket);
+        adjust_occupancy_after_erase(pbucket);
         ETL_DECREMENT_DEBUG_COUNT
 
         icurrent = inext;
@@ -933,13 +938,13 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = find_next_occupied_bucket(pbucket);
 
-            iprevious = pbucket->before_begin();
-            icurrent  = pbucket->begin();
+            if (pbucket != end_bucket())
+            {
+              iprevious = pbucket->before_begin();
+              icurrent  = pbucket->begin();
+            }
           }
         }
       }
@@ -981,6 +986,35 @@ namespace etl
       return n;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      size_t n = 0UL;
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+        ++n;
+
+        while ((l != end()) && key_equal_function(key, l->first))
+        {
+          ++l;
+          ++n;
+        }
+      }
+
+      return n;
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1005,7 +1039,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1039,7 +1073,43 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return const_iterator(this, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1049,6 +1119,42 @@ namespace etl
       return end();
     }
 
+    //*********************************************************************
+    /// Finds an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return const_iterator(this, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1101,6 +1207,62 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+
+        while ((l != end()) && key_equal_function(key, l->first))
+        {
+          ++l;
+        }
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+
+        while ((l != end()) && key_equal_function(key, l->first))
+        {
+          ++l;
+        }
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_multimap.
     //*************************************************************************
@@ -1212,10 +1374,11 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::ibitset& occupied_)
       : pnodepool(&node_pool_),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        poccupied(&occupied_)
     {
     }
 
@@ -1254,7 +1417,7 @@ namespace etl
       }
 
       first = pbuckets;
-      last = first;
+      poccupied->reset();
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -1282,71 +1445,51 @@ namespace etl
     }
 
     //*********************************************************************
-    /// Adjust the first and last markers according to the new entry.
+    /// Mark the bucket as occupied and adjust the first marker according to the new entry.
     //*********************************************************************
-    void adjust_first_last_markers_after_insert(bucket_t* pbucket)
+    void adjust_occupancy_after_insert(bucket_t* pbucket)
     {
-      if (size() == 1)
+      poccupied->set(size_t(pbucket - pbuckets));
+
+      if ((size() == 1) || (pbucket < first))
       {
         first = pbucket;
-        last = pbucket;
-      }
-      else
-      {
-        if (pbucket < first)
-        {
-          first = pbucket;
-        }
-        else if (pbucket > last)
-        {
-          last = pbucket;
-        }
       }
     }
 
     //*********************************************************************
-    /// Adjust the first and last markers according to the erased entry.
+    /// Mark the bucket as unoccupied if the erase emptied it, and adjust the first marker.
     //*********************************************************************
-    void adjust_first_last_markers_after_erase(bucket_t* pbucket)
+    void adjust_occupancy_after_erase(bucket_t* pbucket)
     {
-      if (empty())
-      {
-        first = pbuckets;
-        last = pbuckets;
-      }
-      else
+      if (pbucket->empty())
       {
+        poccupied->reset(size_t(pbucket - pbuckets));
+
+        // We emptied the first, so search the bitmap for the next one.
         if (pbucket == first)
         {
-          // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = empty() ? pbuckets : find_next_occupied_bucket(pbucket);
         }
-        else if (pbucket == last)
-        {
-          // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pbucket = first;
-          bucket_t* pend = last;
+      }
+    }
 
-          last = first;
+    //*********************************************************************
+    /// Finds the next occupied bucket after pbucket, or end_bucket() if there are none.
+    //*********************************************************************
+    bucket_t* find_next_occupied_bucket(const bucket_t* pbucket) const
+    {
+      size_t index = poccupied->find_next(true, size_t(pbucket - pbuckets) + 1U);
 
-          while (pbucket != pend)
-          {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
+      return (index == etl::ibitset::npos) ? end_bucket() : pbuckets + index;
+    }
 
-            ++pbucket;
-          }
-        }
-        else
-        {
-          // Nothing to do.
-        }
-      }
+    //*********************************************************************
+    /// Gets the bucket past the last one.
+    //*********************************************************************
+    bucket_t* end_bucket() const
+    {
+      return pbuckets + number_of_buckets;
     }
 
     // Disable copy construction.
@@ -1361,9 +1504,11 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
-    /// The first and last iterators to buckets with values.
+    /// The bitmap of buckets with values.
+    etl::ibitset* poccupied;
+
+    /// The pointer to the first bucket with values.
     bucket_t* first;
-    bucket_t* last;
 
     /// The function that creates the hashes.
     hasher key_hash_function;
@@ -1435,7 +1580,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_multimap()
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::initialise();
     }
@@ -1444,7 +1589,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_multimap(const unordered_multimap& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1458,7 +1603,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_multimap(unordered_multimap&& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1476,7 +1621,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_multimap(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(first_, last_);
     }
@@ -1486,7 +1631,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_multimap(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init)
-      : base(node_pool, buckets, MAX_BUCKETS_)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupied)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1538,6 +1683,9 @@ namespace etl
 
     /// The buckets of node lists.
     etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The bitmap of buckets with values.
+    etl::bitset<MAX_BUCKETS_> occupied;
   };
 
   //*************************************************************************
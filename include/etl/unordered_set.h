@@ -42,6 +42,7 @@ SOFTWARE.
 #include "pool.h"
 #include "vector.h"
 #include "intrusive_forward_list.h"
+#include "bitset.h"
 #include "hash.h"
 #include "type_traits.h"
 #include "parameter_type.h"
@@ -52,6 +53,7 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 #include "placement_new.h"
+#include "private/comparator_is_transparent.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -194,7 +196,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -208,15 +210,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Skip straight to the next occupied bucket.
+          pbucket = pmap->find_next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pmap->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -236,7 +234,7 @@ namespace etl
       //*********************************
       iterator& operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pmap = other.pmap;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -275,8 +273,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      iterator(const iunordered_set* pmap_, bucket_t* pbucket_, local_iterator inode_)
+        : pmap(pmap_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -306,7 +304,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const iunordered_set* pmap;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -336,7 +334,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_set::iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -344,7 +342,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end),
+        : pmap(other.pmap),
         pbucket(other.pbucket),
         inode(other.inode)
       {
@@ -358,16 +356,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Skip straight to the next occupied bucket.
+          pbucket = pmap->find_next_occupied_bucket(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != pmap->end_bucket())
           {
             inode = pbucket->begin();
           }
@@ -387,7 +380,7 @@ namespace etl
       //*********************************
       const_iterator& operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        pmap = other.pmap;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -426,8 +419,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_),
+      const_iterator(const iunordered_set* pmap_, bucket_t* pbucket_, local_iterator inode_)
+        : pmap(pmap_),
           pbucket(pbucket_),
           inode(inode_)
       {
@@ -457,7 +450,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const iunordered_set* pmap;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -470,7 +463,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator(pbuckets + number_of_buckets, first, first->begin());
+      return iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -479,7 +472,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -488,7 +481,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      return const_iterator(this, first, first->begin());
     }
 
     //*********************************************************************
@@ -524,7 +517,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator(pbuckets + number_of_buckets, last, last->end());
+      return iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -533,7 +526,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator(pbuckets + number_of_buckets, last, last->end());
+      return const_iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -542,7 +535,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator(pbuckets + number_of_buckets, last, last->end());
+      return const_iterator(this, end_bucket(), local_iterator());
     }
 
     //*********************************************************************
@@ -581,6 +574,18 @@ namespace etl
       return key_hash_function(key) % number_of_buckets;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns the bucket index for the key, for transparent hashers and key comparators.
+    ///\return The bucket index for the key.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+#endif
+
     //*********************************************************************
     /// Returns the size of the bucket key.
     ///\return The bucket size of the bucket key.
@@ -662,9 +667,9 @@ namespace etl
 
         // Just add the pointer to the bucket;
         bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(&bucket);
+        adjust_occupancy_after_insert(&bucket);
 
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
+        result.first = iterator(this, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -695,10 +700,10 @@ namespace etl
 
           // Add the node to the end of the bucket;
           bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
+          adjust_occupancy_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
+          result.first = iterator(this, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -735,9 +740,9 @@ namespace etl
 
           // Just add the pointer to the bucket;
           bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(&bucket);
+        adjust_occupancy_after_insert(&bucket);
 
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
+        result.first = iterator(this, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -768,10 +773,10 @@ namespace etl
 
             // Add the node to the end of the bucket;
             bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
+          adjust_occupancy_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
+          result.first = iterator(this, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -848,7 +853,7 @@ namespace etl
         bucket.erase_after(iprevious);  // Unlink from the bucket.
         icurrent->key.~value_type();    // Destroy the value.
         pnodepool->release(&*icurrent); // Release it back to the pool.
-        adjust_first_last_markers_after_erase(&bucket);
+        adjust_occupancy_after_erase(&bucket);
         n = 1;
         ETL_DECREMENT_DEBUG_COUNT
       }
@@ -863,7 +868,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(this, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -879,7 +884,7 @@ namespace etl
       bucket.erase_after(iprevious);  // Unlink from the bucket.
       icurrent->key.~value_type();    // Destroy the value.
       pnodepool->release(&*icurrent); // Release it back to the pool.
-      adjust_first_last_markers_after_erase(&bucket);
+      adjust_occupancy_after_erase(&bucket);
       ETL_DECREMENT_DEBUG_COUNT
 
       return inext;
@@ -902,7 +907,7 @@ namespace etl
       }
 
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(this, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket     = first_.get_bucket_list_iterator();
@@ -924,7 +929,7 @@ namespace etl
         local_iterator inext = pbucket->erase_after(iprevious); // Unlink from the bucket.
         icurrent->key.~value_type();    // Destroy the value.
         pnodepool->release(&*icurrent); // Release it back to the pool.
-        adjust_first_last_markers_after_erase(pbucket);
+        adjust_occupancy_after_erase(pbucket);
         ETL_DECREMENT_DEBUG_COUNT
 
         icurrent = inext;
@@ -936,13 +941,13 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = find_next_occupied_bucket(pbucket);
 
-            iprevious = pbucket->before_begin();
-            icurrent  = pbucket->begin();
+            if (pbucket != end_bucket())
+            {
+              iprevious = pbucket->before_begin();
+              icurrent  = pbucket->begin();
+            }
           }
         }
       }
@@ -968,6 +973,19 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -992,7 +1010,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key))
           {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1026,7 +1044,43 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key))
           {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+            return iterator(this, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key))
+          {
+            return iterator(this, pbucket, inode);
           }
 
           ++inode;
@@ -1036,6 +1090,42 @@ namespace etl
       return end();
     }
 
+    //*********************************************************************
+    /// Finds an element, for transparent hashers and key comparators.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key))
+          {
+            return iterator(this, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key 'key' in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1078,6 +1168,52 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_set.
     //*************************************************************************
@@ -1190,10 +1326,11 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::ibitset& occupied_)
       : pnodepool(&node_pool_),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        poccupied(&occupied_)
     {
     }
 
@@ -1232,7 +1369,7 @@ namespace etl
       }
 
       first = pbuckets;
-      last = first;
+      poccupied->reset();
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -1266,71 +1403,51 @@ namespace etl
     }
 
     //*********************************************************************
-    /// Adjust the first and last markers according to the new entry.
+    /// Mark the bucket as occupied and adjust the first marker according to the new entry.
     //*********************************************************************
-    void adjust_first_last_markers_after_insert(bucket_t* pbucket)
+    void adjust_occupancy_after_insert(bucket_t* pbucket)
     {
-      if (size() == 1)
+      poccupied->set(size_t(pbucket - pbuckets));
+
+      if ((size() == 1) || (pbucket < first))
       {
         first = pbucket;
-        last = pbucket;
-      }
-      else
-      {
-        if (pbucket < first)
-        {
-          first = pbucket;
-        }
-        else if (pbucket > last)
-        {
-          last = pbucket;
-        }
       }
     }
 
     //*********************************************************************
-    /// Adjust the first and last markers according to the erased entry.
+    /// Mark the bucket as unoccupied if the erase emptied it, and adjust the first marker.
     //*********************************************************************
-    void adjust_first_last_markers_after_erase(bucket_t* pbucket)
+    void adjust_occupancy_after_erase(bucket_t* pbucket)
     {
-      if (empty())
-      {
-        first = pbuckets;
-        last = pbuckets;
-      }
-      else
+      if (pbucket->empty())
       {
+        poccupied->reset(size_t(pbucket - pbuckets));
+
+        // We emptied the first, so search the bitmap for the next one.
         if (pbucket == first)
         {
-          // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          first = empty() ? pbuckets : find_next_occupied_bucket(pbucket);
         }
-        else if (pbucket == last)
-        {
-          // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pbucket = first;
-          bucket_t* pend = last;
+      }
+    }
 
-          last = first;
+    //*********************************************************************
+    /// Finds the next occupied bucket after pbucket, or end_bucket() if there are none.
+    //*********************************************************************
+    bucket_t* find_next_occupied_bucket(const bucket_t* pbucket) const
+    {
+      size_t index = poccupied->find_next(true, size_t(pbucket - pbuckets) + 1U);
 
-          while (pbucket != pend)
-          {
-            if (!pbucket->empty())
-            {
-              last = pbucket;
-            }
+      return (index == etl::ibitset::npos) ? end_bucket() : pbuckets + index;
+    }
 
-            ++pbucket;
-          }
-        }
-        else
-        {
-          // Nothing to do.
-        }
-      }
+    //*********************************************************************
+    /// Gets the bucket past the last one.
+    //*********************************************************************
+    bucket_t* end_bucket() const
+    {
+      return pbuckets + number_of_buckets;
     }
 
     // Disable copy construction.
@@ -1345,9 +1462,11 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
-    /// The first and last iterators to buckets with values.
+    /// The bitmap of buckets with values.
+    etl::ibitset* poccupied;
+
+    /// The pointer to the first bucket with values.
     bucket_t* first;
-    bucket_t* last;
 
     /// The function that creates the hashes.
     hasher key_hash_function;
@@ -1419,7 +1538,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_set()
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::initialise();
     }
@@ -1428,7 +1547,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_set(const unordered_set& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1442,7 +1561,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_set(unordered_set&& other)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1460,7 +1579,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_set(TIterator first_, TIterator last_)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(first_, last_);
     }
@@ -1470,7 +1589,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_set(std::initializer_list<TKey> init)
-      : base(node_pool, buckets, MAX_BUCKETS)
+      : base(node_pool, buckets, MAX_BUCKETS, occupied)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1522,6 +1641,9 @@ namespace etl
 
     /// The buckets of node lists.
     etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The bitmap of buckets with values.
+    etl::bitset<MAX_BUCKETS_> occupied;
   };
 
   //*************************************************************************
@@ -435,6 +435,19 @@ namespace etl
   template <size_t I>
   inline constexpr in_place_index_t<I> in_place_index{};
 #endif
+
+  //***************************************************************************
+  /// sorted_unique disambiguation tag.
+  /// Indicates that a range is already sorted and contains no duplicate keys.
+  //***************************************************************************
+  struct sorted_unique_t
+  {
+    explicit ETL_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if ETL_CPP17_SUPPORTED
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
 }
 
 #endif
@@ -0,0 +1,84 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+//*****************************************************************************
+/// Simple portable stopwatch for the benchmarks.
+//*****************************************************************************
+class Stopwatch
+{
+public:
+
+  Stopwatch()
+  {
+    start();
+  }
+
+  void start()
+  {
+    begin = std::chrono::steady_clock::now();
+  }
+
+  double elapsed_ms() const
+  {
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+
+    return elapsed.count();
+  }
+
+private:
+
+  std::chrono::steady_clock::time_point begin;
+};
+
+//*****************************************************************************
+/// Prints a benchmark result line.
+//*****************************************************************************
+inline void report(const std::string& name, double ms)
+{
+  std::cout << std::left << std::setw(48) << name << std::right << std::setw(12) << std::fixed << std::setprecision(3) << ms << " ms\n";
+}
+
+//*****************************************************************************
+/// Stops the optimiser from discarding a result.
+//*****************************************************************************
+template <typename T>
+inline void do_not_optimise(const T& value)
+{
+  static volatile const T* volatile sink;
+  sink = &value;
+}
+
+#endif
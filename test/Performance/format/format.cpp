@@ -0,0 +1,147 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+//*****************************************************************************
+// Compares etl::format with etl::string_stream and snprintf for a log line.
+// Each formats the same five values into a fixed capacity string.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/format.h"
+#include "etl/string_stream.h"
+#include "etl/string.h"
+
+#include <stdio.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Lines = 2000000UL;
+
+  typedef etl::string<100> Line;
+
+  //***************************************************************************
+  struct Record
+  {
+    uint32_t    timestamp;
+    const char* level;
+    int         id;
+    double      value;
+    const char* name;
+  };
+
+  //***************************************************************************
+  std::vector<Record> make_records()
+  {
+    static const char* levels[] = { "INFO", "WARNING", "ERROR" };
+    static const char* names[]  = { "pump", "valve", "heater", "sensor" };
+
+    std::mt19937 urng(12345);
+    std::vector<Record> records;
+
+    for (size_t i = 0UL; i < 1000UL; ++i)
+    {
+      Record record = { uint32_t(urng() % 100000000U), levels[urng() % 3U], int(urng() % 65536U), double(urng() % 1000000U) / 1000.0, names[urng() % 4U] };
+      records.push_back(record);
+    }
+
+    return records;
+  }
+
+  //***************************************************************************
+  void with_format(Line& line, const Record& r)
+  {
+    etl::format(line, ETL_FORMAT_STRING("[{:>8}] {:<8} id={:x} value={:.3f} name={}"), r.timestamp, r.level, r.id, r.value, r.name);
+  }
+
+  //***************************************************************************
+  void with_string_stream(Line& line, const Record& r)
+  {
+    line.clear();
+
+    etl::string_stream ss(line);
+
+    ss << "[" << etl::setw(8) << r.timestamp << etl::setw(0) << "] "
+       << etl::left << etl::setw(8) << r.level << etl::setw(0) << etl::right
+       << " id=" << etl::hex << r.id << etl::dec
+       << " value=" << etl::setprecision(3) << r.value
+       << " name=" << r.name;
+  }
+
+  //***************************************************************************
+  void with_snprintf(Line& line, const Record& r)
+  {
+    char buffer[Line::MAX_SIZE + 1U];
+
+    int length = snprintf(buffer, sizeof(buffer), "[%8u] %-8s id=%x value=%.3f name=%s", unsigned(r.timestamp), r.level, unsigned(r.id), r.value, r.name);
+
+    line.assign(buffer, size_t(length));
+  }
+
+  //***************************************************************************
+  template <typename TFormat>
+  double time_lines(const std::vector<Record>& records, TFormat format_line)
+  {
+    Line   line;
+    size_t total = 0UL;
+
+    Stopwatch stopwatch;
+
+    for (size_t i = 0UL; i < Lines; ++i)
+    {
+      format_line(line, records[i % records.size()]);
+      total += line.size();
+    }
+
+    double ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(total);
+
+    return ms;
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  const std::vector<Record> records = make_records();
+
+  Line line;
+  with_format(line, records[0]);
+  std::cout << "\n" << line.c_str() << "\n";
+
+  std::cout << "\nlog line (" << Lines << " lines)\n";
+  report("  etl::string_stream", time_lines(records, with_string_stream));
+  report("  snprintf",           time_lines(records, with_snprintf));
+  report("  etl::format",        time_lines(records, with_format));
+
+  return 0;
+}
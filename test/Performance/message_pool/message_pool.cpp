@@ -0,0 +1,152 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+//*****************************************************************************
+// Compares reference_counted_message_pool allocation through a mutex locked
+// fixed_sized_memory_block_allocator with the lock-free
+// fixed_sized_memory_block_allocator_atomic, at 1 to 16 threads.
+// Each thread repeatedly allocates a shared message and releases it.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator_atomic.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t Allocations = 4000000UL;
+  const size_t Blocks      = 256UL;
+
+  struct Message : public etl::message<1>
+  {
+    Message(uint32_t value_)
+      : value(value_)
+    {
+    }
+
+    uint32_t value;
+  };
+
+  typedef etl::atomic_counted_message_pool::pool_message_parameters<Message> parameters;
+
+  //***************************************************************************
+  class locked_pool : public etl::atomic_counted_message_pool
+  {
+  public:
+
+    locked_pool(etl::imemory_block_allocator& allocator)
+      : etl::atomic_counted_message_pool(allocator)
+    {
+    }
+
+  protected:
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+  private:
+
+    std::mutex mutex;
+  };
+
+  //***************************************************************************
+  template <typename TPool>
+  void time_pool(const std::string& name, TPool& pool, size_t n_threads)
+  {
+    const size_t per_thread = Allocations / n_threads;
+
+    std::vector<std::thread> threads;
+
+    Stopwatch stopwatch;
+
+    for (size_t t = 0UL; t < n_threads; ++t)
+    {
+      threads.emplace_back([&pool, per_thread]()
+      {
+        uint32_t sum = 0U;
+
+        for (size_t i = 0UL; i < per_thread; ++i)
+        {
+          etl::shared_message sm(pool, Message(uint32_t(i)));
+          sum += static_cast<const Message&>(sm.get_message()).value;
+        }
+
+        do_not_optimise(sum);
+      });
+    }
+
+    for (size_t t = 0UL; t < threads.size(); ++t)
+    {
+      threads[t].join();
+    }
+
+    const double ms = stopwatch.elapsed_ms();
+
+    std::ostringstream oss;
+    oss << "  " << name << ", " << n_threads << " threads (" << std::fixed << std::setprecision(1)
+        << (double(per_thread * n_threads) / (ms * 1000.0)) << " M/s)";
+
+    report(oss.str(), ms);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::cout << "\n" << Allocations << " allocations and releases, " << std::thread::hardware_concurrency() << " hardware threads\n";
+
+  for (size_t n_threads = 1UL; n_threads <= 16UL; n_threads *= 2UL)
+  {
+    etl::fixed_sized_memory_block_allocator<parameters::max_size, parameters::max_alignment, Blocks> locked_allocator;
+    locked_pool locked(locked_allocator);
+
+    etl::fixed_sized_memory_block_allocator_atomic<parameters::max_size, parameters::max_alignment, Blocks> atomic_allocator;
+    etl::atomic_counted_message_pool lock_free(atomic_allocator);
+
+    time_pool("locked",    locked,    n_threads);
+    time_pool("lock-free", lock_free, n_threads);
+  }
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+//*****************************************************************************
+// Compares etl::queue_mpmc_mutex and etl::queue_mpmc_atomic.
+// Equal numbers of producer and consumer threads pass a fixed number of
+// items through the queue. The time is from the first push to the last pop.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_mpmc_atomic.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  const size_t Items      = 2000000UL;
+  const size_t Queue_Size = 1024UL;
+
+  etl::queue_mpmc_mutex<uint32_t, Queue_Size>  mutex_queue;
+  etl::queue_mpmc_atomic<uint32_t, Queue_Size> atomic_queue;
+
+  //***************************************************************************
+  template <typename TQueue>
+  void time_queue(const std::string& name, TQueue& queue, size_t n_threads)
+  {
+    const size_t items_per_producer = Items / n_threads;
+    const size_t total              = items_per_producer * n_threads;
+
+    std::atomic<size_t>   remaining(total);
+    std::atomic<uint64_t> sum(0U);
+    std::atomic<bool>     go(false);
+
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0UL; p < n_threads; ++p)
+    {
+      threads.emplace_back([&]()
+      {
+        while (!go.load())
+        {
+        }
+
+        for (size_t i = 0UL; i < items_per_producer; ++i)
+        {
+          while (!queue.push(uint32_t(i)))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    for (size_t c = 0UL; c < n_threads; ++c)
+    {
+      threads.emplace_back([&]()
+      {
+        uint64_t local_sum = 0U;
+        uint32_t value;
+
+        while (!go.load())
+        {
+        }
+
+        while (remaining.load(std::memory_order_relaxed) > 0U)
+        {
+          if (queue.pop(value))
+          {
+            local_sum += value;
+            remaining.fetch_sub(1U, std::memory_order_relaxed);
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        sum += local_sum;
+      });
+    }
+
+    Stopwatch stopwatch;
+    go.store(true);
+
+    for (size_t i = 0UL; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    const double ms = stopwatch.elapsed_ms();
+
+    const uint64_t expected = uint64_t(n_threads) * ((uint64_t(items_per_producer) * (items_per_producer - 1U)) / 2U);
+
+    if (sum.load() != expected)
+    {
+      std::cout << "*** Incorrect result ***\n";
+    }
+
+    do_not_optimise(sum);
+
+    report(name + " " + std::to_string(n_threads) + "P/" + std::to_string(n_threads) + "C", ms);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::cout << "\n" << Items << " items through a queue of " << Queue_Size << "\n";
+
+  const size_t thread_counts[] = { 1UL, 2UL, 4UL, 8UL };
+
+  for (size_t n_threads : thread_counts)
+  {
+    time_queue("  etl::queue_mpmc_mutex ", mutex_queue,  n_threads);
+    time_queue("  etl::queue_mpmc_atomic", atomic_queue, n_threads);
+  }
+
+  return 0;
+}
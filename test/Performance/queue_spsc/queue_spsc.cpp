@@ -0,0 +1,151 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+//*****************************************************************************
+// Times etl::queue_spsc_atomic with one producer thread and one consumer
+// thread, pushing and popping one item at a time and in batches.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/queue_spsc_atomic.h"
+
+#include <string>
+#include <thread>
+#include <stdint.h>
+
+namespace
+{
+  const uint32_t Items      = 2000000UL;
+  const size_t   Queue_Size = 1024UL;
+
+  etl::queue_spsc_atomic<uint32_t, Queue_Size> queue;
+
+  //***************************************************************************
+  void time_single()
+  {
+    Stopwatch stopwatch;
+
+    std::thread producer([]()
+    {
+      for (uint32_t i = 0UL; i < Items; ++i)
+      {
+        while (!queue.push(i))
+        {
+        }
+      }
+    });
+
+    uint64_t sum = 0U;
+    uint32_t value;
+
+    for (uint32_t i = 0UL; i < Items; ++i)
+    {
+      while (!queue.pop(value))
+      {
+      }
+
+      sum += value;
+    }
+
+    producer.join();
+
+    const double ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(sum);
+
+    report("  single push/pop", ms);
+  }
+
+  //***************************************************************************
+  void time_batch(size_t batch_size)
+  {
+    Stopwatch stopwatch;
+
+    std::thread producer([batch_size]()
+    {
+      uint32_t buffer[256];
+      uint32_t next = 0UL;
+
+      while (next < Items)
+      {
+        const uint32_t n = uint32_t(((Items - next) < batch_size) ? (Items - next) : batch_size);
+
+        for (uint32_t i = 0UL; i < n; ++i)
+        {
+          buffer[i] = next + i;
+        }
+
+        uint32_t pushed = 0UL;
+
+        while (pushed < n)
+        {
+          pushed += uint32_t(queue.push(buffer + pushed, buffer + n));
+        }
+
+        next += n;
+      }
+    });
+
+    uint64_t sum = 0U;
+    uint32_t buffer[256];
+    uint32_t received = 0UL;
+
+    while (received < Items)
+    {
+      const size_t n = queue.pop(buffer, batch_size);
+
+      for (size_t i = 0UL; i < n; ++i)
+      {
+        sum += buffer[i];
+      }
+
+      received += uint32_t(n);
+    }
+
+    producer.join();
+
+    const double ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(sum);
+
+    report("  batches of " + std::to_string(batch_size), ms);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::cout << "\n" << Items << " items through a queue of " << Queue_Size << "\n";
+
+  time_single();
+  time_batch(16UL);
+  time_batch(64UL);
+  time_batch(256UL);
+
+  return 0;
+}
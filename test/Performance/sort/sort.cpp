@@ -0,0 +1,137 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Compares etl::intro_sort and etl::shell_sort with std::sort.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+  typedef std::vector<int> Data;
+
+  const size_t Sizes[] = { 10000UL, 100000UL };
+
+  //***************************************************************************
+  Data make_random(size_t size)
+  {
+    std::mt19937 urng(12345);
+    Data data(size);
+
+    for (size_t i = 0UL; i < size; ++i)
+    {
+      data[i] = int(urng());
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  Data make_sorted(size_t size)
+  {
+    Data data(size);
+    std::iota(data.begin(), data.end(), 0);
+
+    return data;
+  }
+
+  //***************************************************************************
+  Data make_reversed(size_t size)
+  {
+    Data data(size);
+    std::iota(data.rbegin(), data.rend(), 0);
+
+    return data;
+  }
+
+  //***************************************************************************
+  Data make_duplicates(size_t size)
+  {
+    std::mt19937 urng(12345);
+    Data data(size);
+
+    for (size_t i = 0UL; i < size; ++i)
+    {
+      data[i] = int(urng() % 16);
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename TSort>
+  double time_sort(const Data& input, TSort sort)
+  {
+    Data data(input);
+
+    Stopwatch stopwatch;
+    sort(data.begin(), data.end());
+    double ms = stopwatch.elapsed_ms();
+
+    if (!std::is_sorted(data.begin(), data.end()))
+    {
+      std::cout << "*** Not sorted ***\n";
+    }
+
+    do_not_optimise(data[0]);
+
+    return ms;
+  }
+
+  //***************************************************************************
+  void run(const std::string& name, const Data& input)
+  {
+    std::cout << "\n" << name << " (" << input.size() << " elements)\n";
+
+    report("  std::sort",       time_sort(input, [](Data::iterator b, Data::iterator e) { std::sort(b, e); }));
+    report("  etl::intro_sort", time_sort(input, [](Data::iterator b, Data::iterator e) { etl::intro_sort(b, e); }));
+    report("  etl::shell_sort", time_sort(input, [](Data::iterator b, Data::iterator e) { etl::shell_sort(b, e); }));
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  for (size_t size : Sizes)
+  {
+    run("Random",          make_random(size));
+    run("Sorted",          make_sorted(size));
+    run("Reversed",        make_reversed(size));
+    run("Many duplicates", make_duplicates(size));
+  }
+
+  return 0;
+}
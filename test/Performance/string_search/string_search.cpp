@@ -0,0 +1,187 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+//*****************************************************************************
+// Compares the etl::string search functions with the character at a time
+// loops that they replaced and with std::string.
+// Each search scans a 4000 character text for a target that is not there,
+// so that the whole text is read every time.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/string.h"
+#include "etl/algorithm.h"
+
+#include <random>
+#include <string>
+
+namespace
+{
+  const size_t Length   = 4000UL;
+  const size_t Searches = 200000UL;
+
+  typedef etl::string<Length> Text;
+
+  //***************************************************************************
+  /// Lower case words separated by spaces.
+  //***************************************************************************
+  Text make_text()
+  {
+    std::mt19937 urng(12345);
+    Text text;
+
+    while (!text.full())
+    {
+      text.push_back(((urng() % 6U) == 0U) ? ' ' : char('a' + (urng() % 26U)));
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  /// The search for a string as it was, with etl::search.
+  //***************************************************************************
+  size_t previous_find(const Text& text, const char* s, size_t n)
+  {
+    Text::const_iterator itr = etl::search(text.begin(), text.end(), s, s + n);
+
+    return (itr == text.end()) ? Text::npos : size_t(etl::distance(text.begin(), itr));
+  }
+
+  //***************************************************************************
+  /// The search for a character as it was, with etl::find.
+  //***************************************************************************
+  size_t previous_find_char(const Text& text, char c)
+  {
+    Text::const_iterator itr = etl::find(text.begin(), text.end(), c);
+
+    return (itr == text.end()) ? Text::npos : size_t(etl::distance(text.begin(), itr));
+  }
+
+  //***************************************************************************
+  /// The search for one of a set of characters as it was, with nested loops.
+  //***************************************************************************
+  size_t previous_find_first_of(const Text& text, const char* s, size_t n)
+  {
+    for (size_t i = 0UL; i < text.size(); ++i)
+    {
+      for (size_t j = 0UL; j < n; ++j)
+      {
+        if (text[i] == s[j])
+        {
+          return i;
+        }
+      }
+    }
+
+    return Text::npos;
+  }
+
+  //***************************************************************************
+  /// The comparison as it was, a character at a time.
+  //***************************************************************************
+  int previous_compare(const Text& lhs, const Text& rhs)
+  {
+    for (size_t i = 0UL; (i < lhs.size()) && (i < rhs.size()); ++i)
+    {
+      if (lhs[i] < rhs[i])
+      {
+        return -1;
+      }
+      else if (rhs[i] < lhs[i])
+      {
+        return 1;
+      }
+    }
+
+    return (lhs.size() < rhs.size()) ? -1 : ((rhs.size() < lhs.size()) ? 1 : 0);
+  }
+
+  //***************************************************************************
+  template <typename TSearch>
+  double time_search(TSearch search)
+  {
+    size_t total = 0UL;
+
+    Stopwatch stopwatch;
+
+    for (size_t i = 0UL; i < Searches; ++i)
+    {
+      total += search(i);
+    }
+
+    double ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(total);
+
+    return ms;
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  const Text        text     = make_text();
+  const Text        copy     = text;
+  const std::string std_text(text.begin(), text.end());
+  const std::string std_copy = std_text;
+
+  // Ends with an upper case letter, so the common prefixes are found but never the whole string.
+  const char*  needle        = "the quickX";
+  const size_t needle_length = 10UL;
+  const char*  delimiters    = ",;.!?:-()";
+  const size_t n_delimiters  = 9UL;
+
+  std::cout << "\nfind string (" << Searches << " searches of " << Length << " characters)\n";
+  report("  previous",    time_search([&](size_t) { return previous_find(text, needle, needle_length); }));
+  report("  etl::string", time_search([&](size_t) { return text.find(needle, 0U, needle_length); }));
+  report("  std::string", time_search([&](size_t) { return std_text.find(needle, 0U, needle_length); }));
+
+  std::cout << "\nfind character\n";
+  report("  previous",    time_search([&](size_t) { return previous_find_char(text, 'X'); }));
+  report("  etl::string", time_search([&](size_t) { return text.find('X'); }));
+  report("  std::string", time_search([&](size_t) { return std_text.find('X'); }));
+
+  std::cout << "\nrfind character\n";
+  report("  etl::string", time_search([&](size_t) { return text.rfind('X'); }));
+  report("  std::string", time_search([&](size_t) { return std_text.rfind('X'); }));
+
+  std::cout << "\nfind_first_of " << n_delimiters << " characters\n";
+  report("  previous",    time_search([&](size_t) { return previous_find_first_of(text, delimiters, n_delimiters); }));
+  report("  etl::string", time_search([&](size_t) { return text.find_first_of(delimiters, 0U, n_delimiters); }));
+  report("  std::string", time_search([&](size_t) { return std_text.find_first_of(delimiters, 0U, n_delimiters); }));
+
+  std::cout << "\ncompare equal strings\n";
+  report("  previous",    time_search([&](size_t) { return size_t(previous_compare(text, copy) + 1); }));
+  report("  etl::string", time_search([&](size_t) { return size_t(text.compare(copy) + 1); }));
+  report("  std::string", time_search([&](size_t) { return size_t(std_text.compare(std_copy) + 1); }));
+
+  return 0;
+}
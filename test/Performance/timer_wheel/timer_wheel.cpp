@@ -0,0 +1,137 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+//*****************************************************************************
+// Compares etl::callback_timer and etl::callback_timer_wheel.
+// Each test starts all of the timers with random periods, ticks one tick at a
+// time, restarts every timer (as a watchdog would), then stops them all.
+// etl::callback_timer is limited to 254 timers, so the wheel is also timed
+// with 10000 active timers.
+//*****************************************************************************
+
+#define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+
+#include "benchmark.h"
+
+#include "etl/callback_timer.h"
+#include "etl/callback_timer_wheel.h"
+
+#include <random>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  const uint32_t Max_Period = 10000UL;
+  const uint32_t Ticks      = 100000UL;
+
+  // The timers are too large for the stack.
+  etl::callback_timer<254>         list_timer_254;
+  etl::callback_timer_wheel<254>   wheel_timer_254;
+  etl::callback_timer_wheel<10000> wheel_timer_10000;
+
+  uint64_t called = 0ULL;
+
+  //***************************************************************************
+  void callback()
+  {
+    ++called;
+  }
+
+  //***************************************************************************
+  template <typename TTimer>
+  void time_timer(const std::string& name, TTimer& timer, size_t n_timers)
+  {
+    typedef decltype(timer.register_timer(callback, 1U, true)) id_type;
+
+    std::mt19937 urng(12345);
+    std::vector<id_type> ids(n_timers);
+
+    timer.clear();
+
+    for (size_t i = 0UL; i < n_timers; ++i)
+    {
+      ids[i] = timer.register_timer(callback, (urng() % Max_Period) + 1U, etl::timer::mode::REPEATING);
+    }
+
+    timer.enable(true);
+    called = 0ULL;
+
+    Stopwatch stopwatch;
+
+    for (size_t i = 0UL; i < n_timers; ++i)
+    {
+      timer.start(ids[i]);
+    }
+
+    const double start_ms = stopwatch.elapsed_ms();
+    stopwatch.start();
+
+    for (uint32_t i = 0UL; i < Ticks; ++i)
+    {
+      timer.tick(1U);
+    }
+
+    const double tick_ms = stopwatch.elapsed_ms();
+    stopwatch.start();
+
+    for (size_t i = 0UL; i < n_timers; ++i)
+    {
+      timer.start(ids[i]);
+    }
+
+    const double restart_ms = stopwatch.elapsed_ms();
+    stopwatch.start();
+
+    for (size_t i = 0UL; i < n_timers; ++i)
+    {
+      timer.stop(ids[i]);
+    }
+
+    const double stop_ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(called);
+
+    std::cout << "\n" << name << " (" << n_timers << " timers, " << Ticks << " ticks, " << called << " callbacks)\n";
+
+    report("  start",   start_ms);
+    report("  tick",    tick_ms);
+    report("  restart", restart_ms);
+    report("  stop",    stop_ms);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  time_timer("etl::callback_timer",       list_timer_254,    254UL);
+  time_timer("etl::callback_timer_wheel", wheel_timer_254,   254UL);
+  time_timer("etl::callback_timer_wheel", wheel_timer_10000, 10000UL);
+
+  return 0;
+}
@@ -0,0 +1,243 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+
+//*****************************************************************************
+// Compares etl::to_arithmetic for integers with a digit at a time algorithm
+// and with strtoll.
+// Compares etl::to_arithmetic for doubles with strtod.
+// The text is in one buffer and is not NUL terminated for etl::to_arithmetic.
+// strtoll and strtod are given a terminated copy of each value.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/to_arithmetic.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Values = 5000000UL;
+
+  //***************************************************************************
+  /// Values as text, one after another, with the offset of each.
+  //***************************************************************************
+  struct Text
+  {
+    std::vector<char>   characters;
+    std::vector<size_t> offsets;
+
+    void add(const char* value)
+    {
+      offsets.push_back(characters.size());
+      characters.insert(characters.end(), value, value + strlen(value));
+    }
+
+    const char* begin(size_t i) const
+    {
+      return characters.data() + offsets[i];
+    }
+
+    const char* end(size_t i) const
+    {
+      return characters.data() + (((i + 1U) < offsets.size()) ? offsets[i + 1U] : characters.size());
+    }
+
+    size_t size() const
+    {
+      return offsets.size();
+    }
+  };
+
+  //***************************************************************************
+  /// One digit per iteration, as a parser without eight digits at a time would.
+  //***************************************************************************
+  int64_t digit_at_a_time(const char* p, const char* last)
+  {
+    bool negative = (*p == '-');
+
+    if (negative)
+    {
+      ++p;
+    }
+
+    uint64_t value = 0U;
+
+    while ((p != last) && (*p >= '0') && (*p <= '9'))
+    {
+      value = (value * 10U) + uint64_t(*p - '0');
+      ++p;
+    }
+
+    return negative ? -int64_t(value) : int64_t(value);
+  }
+
+  //***************************************************************************
+  /// Random integers, shifted right by 0 to 'shifts' - 1 bits.
+  //***************************************************************************
+  Text make_integer_text(size_t shifts)
+  {
+    std::mt19937_64 urng(12345);
+    Text text;
+
+    for (size_t i = 0UL; i < Values; ++i)
+    {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(int64_t(urng()) >> (i % shifts)));
+      text.add(buffer);
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  /// Random doubles of any magnitude, with enough digits to round trip.
+  //***************************************************************************
+  Text make_full_precision_text()
+  {
+    std::mt19937_64 urng(12345);
+    Text text;
+
+    while (text.size() < Values)
+    {
+      uint64_t bits = urng();
+      double value;
+      memcpy(&value, &bits, sizeof(value));
+
+      if ((value == value) && ((value - value) == 0.0))
+      {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+        text.add(buffer);
+      }
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  /// Random values below 10^6, with three decimal places.
+  //***************************************************************************
+  Text make_three_decimal_place_text()
+  {
+    std::mt19937_64 urng(12345);
+    Text text;
+
+    for (size_t i = 0UL; i < Values; ++i)
+    {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%.3f", double(int64_t(urng() % 2000000000U) - 1000000000) / 1000.0);
+      text.add(buffer);
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  template <typename T, typename TParse>
+  double time_parse(const Text& text, TParse parse)
+  {
+    T total = T(0);
+
+    Stopwatch stopwatch;
+
+    for (size_t i = 0UL; i < text.size(); ++i)
+    {
+      total += parse(text.begin(i), text.end(i));
+    }
+
+    double ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(total);
+
+    return ms;
+  }
+
+  //***************************************************************************
+  /// Copies the value to a terminated buffer, as the C functions need.
+  //***************************************************************************
+  struct terminated
+  {
+    terminated(const char* first, const char* last)
+    {
+      const size_t length = size_t(last - first);
+      memcpy(buffer, first, length);
+      buffer[length] = '\0';
+    }
+
+    char buffer[40];
+  };
+
+  //***************************************************************************
+  void run_integers(const char* name, const Text& text)
+  {
+    std::cout << "\n" << name << " (" << text.size() << " values)\n";
+
+    report("  digit at a time",       time_parse<int64_t>(text, [](const char* first, const char* last) { return digit_at_a_time(first, last); }));
+    report("  etl::to_arithmetic",    time_parse<int64_t>(text, [](const char* first, const char* last)
+                                                          {
+                                                            return etl::to_arithmetic<int64_t>(first, size_t(last - first)).value();
+                                                          }));
+    report("  strtoll",               time_parse<int64_t>(text, [](const char* first, const char* last)
+                                                          {
+                                                            return int64_t(strtoll(terminated(first, last).buffer, NULL, 10));
+                                                          }));
+  }
+
+  //***************************************************************************
+  void run_doubles(const char* name, const Text& text)
+  {
+    std::cout << "\n" << name << " (" << text.size() << " values)\n";
+
+    report("  etl::to_arithmetic",    time_parse<double>(text, [](const char* first, const char* last)
+                                                         {
+                                                           return etl::to_arithmetic<double>(first, size_t(last - first)).value();
+                                                         }));
+    report("  strtod",                time_parse<double>(text, [](const char* first, const char* last)
+                                                         {
+                                                           return strtod(terminated(first, last).buffer, NULL);
+                                                         }));
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  run_integers("Full 64 bit integers", make_integer_text(1UL));
+  run_integers("Mixed width integers", make_integer_text(64UL));
+  run_doubles("Full precision doubles", make_full_precision_text());
+  run_doubles("Doubles with three decimal places", make_three_decimal_place_text());
+
+  return 0;
+}
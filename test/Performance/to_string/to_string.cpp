@@ -0,0 +1,258 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Compares etl::to_string for decimal and hexadecimal integers with the
+// previous digit at a time algorithm and with snprintf.
+// Compares etl::to_string for doubles with the previous floor and round
+// algorithm and with snprintf.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/to_string.h"
+#include "etl/string.h"
+#include "etl/format_spec.h"
+#include "etl/algorithm.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Values = 10000000UL;
+
+  typedef std::vector<uint64_t> Data;
+  typedef std::vector<double>   FloatingPointData;
+
+  //***************************************************************************
+  /// The previous algorithm. One digit per division, pushed back in reverse
+  /// order and then reversed.
+  //***************************************************************************
+  template <typename T>
+  void digit_at_a_time(T value, etl::istring& str, uint32_t base, bool append = false)
+  {
+    if (!append)
+    {
+      str.clear();
+    }
+
+    if (value == 0)
+    {
+      str.push_back('0');
+      return;
+    }
+
+    etl::istring::iterator start = str.end();
+
+    while (value != 0)
+    {
+      T remainder = value % T(base);
+      str.push_back((remainder > 9) ? char('a' + (remainder - 10)) : char('0' + remainder));
+      value = value / T(base);
+    }
+
+    etl::reverse(start, str.end());
+  }
+
+  //***************************************************************************
+  /// The previous floating point algorithm, which only works for values
+  /// below 2^32. The integral part and the fractional part, scaled by
+  /// 10^precision, are formatted as integers.
+  //***************************************************************************
+  void floor_and_round(double value, etl::istring& str, uint32_t precision)
+  {
+    uint32_t multiplier = 1U;
+
+    for (uint32_t i = 0U; i < precision; ++i)
+    {
+      multiplier *= 10U;
+    }
+
+    double   f_integral = floor(fabs(value));
+    uint32_t integral   = static_cast<uint32_t>(f_integral);
+    uint32_t fractional = static_cast<uint32_t>(round((fabs(value) - f_integral) * multiplier));
+
+    if (fractional == multiplier)
+    {
+      ++integral;
+      fractional = 0U;
+    }
+
+    str.clear();
+
+    if (value < 0.0)
+    {
+      str.push_back('-');
+    }
+
+    digit_at_a_time(integral, str, 10U, true);
+    str.push_back('.');
+    etl::to_string(fractional, str, etl::format_spec().width(precision).fill('0'), true);
+  }
+
+  //***************************************************************************
+  /// Random values, shifted right by 'minimum_shift' to 'minimum_shift' + 'shifts' - 1 bits.
+  //***************************************************************************
+  Data make_data(size_t minimum_shift, size_t shifts)
+  {
+    std::mt19937_64 urng(12345);
+    Data data(Values);
+
+    for (size_t i = 0UL; i < Values; ++i)
+    {
+      data[i] = urng() >> (minimum_shift + (i % shifts));
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  /// Random values below 2^32, with full precision fractional parts.
+  //***************************************************************************
+  FloatingPointData make_full_precision_data()
+  {
+    std::mt19937_64 urng(12345);
+    std::uniform_real_distribution<double> distribution(-4.0e9, 4.0e9);
+    FloatingPointData data(Values);
+
+    for (size_t i = 0UL; i < Values; ++i)
+    {
+      data[i] = distribution(urng) / double(1U << (i % 32));
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  /// Random values below 10^6, with three decimal places.
+  //***************************************************************************
+  FloatingPointData make_three_decimal_place_data()
+  {
+    std::mt19937_64 urng(12345);
+    FloatingPointData data(Values);
+
+    for (size_t i = 0UL; i < Values; ++i)
+    {
+      data[i] = double(int64_t(urng() % 2000000000U) - 1000000000) / 1000.0;
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename TData, typename TFormat>
+  double time_format(const TData& data, TFormat format)
+  {
+    etl::string<32> str;
+    size_t total = 0UL;
+
+    Stopwatch stopwatch;
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      format(data[i], str);
+      total += str.size();
+    }
+
+    double ms = stopwatch.elapsed_ms();
+
+    do_not_optimise(total);
+
+    return ms;
+  }
+
+  //***************************************************************************
+  void run(const char* name, const Data& data)
+  {
+    std::cout << "\n" << name << " (" << data.size() << " values)\n";
+
+    report("  Decimal: digit at a time", time_format(data, [](uint64_t v, etl::istring& s) { digit_at_a_time(v, s, 10U); }));
+    report("  Decimal: etl::to_string",  time_format(data, [](uint64_t v, etl::istring& s) { etl::to_string(v, s); }));
+    report("  Decimal: snprintf",        time_format(data, [](uint64_t v, etl::istring& s)
+                                                     {
+                                                       char buffer[32];
+                                                       int length = snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(v));
+                                                       s.assign(buffer, size_t(length));
+                                                     }));
+
+    report("  Hex: digit at a time",     time_format(data, [](uint64_t v, etl::istring& s) { digit_at_a_time(v, s, 16U); }));
+    report("  Hex: etl::to_string",      time_format(data, [](uint64_t v, etl::istring& s) { etl::to_string(v, s, etl::format_spec().hex()); }));
+    report("  Hex: snprintf",            time_format(data, [](uint64_t v, etl::istring& s)
+                                                     {
+                                                       char buffer[32];
+                                                       int length = snprintf(buffer, sizeof(buffer), "%llx", static_cast<unsigned long long>(v));
+                                                       s.assign(buffer, size_t(length));
+                                                     }));
+  }
+
+  //***************************************************************************
+  void run(const char* name, const FloatingPointData& data)
+  {
+    std::cout << "\n" << name << " (" << data.size() << " values)\n";
+
+    report("  Fixed: floor and round",    time_format(data, [](double v, etl::istring& s) { floor_and_round(v, s, 6U); }));
+    report("  Fixed: etl::to_string",     time_format(data, [](double v, etl::istring& s) { etl::to_string(v, s, etl::format_spec().precision(6)); }));
+    report("  Fixed: snprintf",           time_format(data, [](double v, etl::istring& s)
+                                                      {
+                                                        char buffer[32];
+                                                        int length = snprintf(buffer, sizeof(buffer), "%.6f", v);
+                                                        s.assign(buffer, size_t(length));
+                                                      }));
+
+    report("  Scientific: etl::to_string", time_format(data, [](double v, etl::istring& s) { etl::to_string(v, s, etl::format_spec().scientific().precision(6)); }));
+    report("  Scientific: snprintf",       time_format(data, [](double v, etl::istring& s)
+                                                       {
+                                                         char buffer[32];
+                                                         int length = snprintf(buffer, sizeof(buffer), "%.6e", v);
+                                                         s.assign(buffer, size_t(length));
+                                                       }));
+
+    report("  Shortest: etl::to_string",  time_format(data, [](double v, etl::istring& s) { etl::to_string(v, s, etl::format_spec().general()); }));
+    report("  Round trip: snprintf %.17g", time_format(data, [](double v, etl::istring& s)
+                                                       {
+                                                         char buffer[32];
+                                                         int length = snprintf(buffer, sizeof(buffer), "%.17g", v);
+                                                         s.assign(buffer, size_t(length));
+                                                       }));
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  run("Full 64 bit values",   make_data(0UL, 1UL));
+  run("Mixed width values",   make_data(0UL, 64UL));
+  run("Values up to 32 bits", make_data(32UL, 32UL));
+  run("Full precision doubles below 2^32", make_full_precision_data());
+  run("Doubles with three decimal places", make_three_decimal_place_data());
+
+  return 0;
+}
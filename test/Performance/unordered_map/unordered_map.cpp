@@ -0,0 +1,189 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+//*****************************************************************************
+// Compares std::unordered_map, etl::unordered_map and etl::flat_hash_map.
+// Each test inserts all of the keys, looks them all up, looks up keys that
+// are not there, then erases them all.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/unordered_map.h"
+#include "etl/flat_hash_map.h"
+
+#include <unordered_map>
+#include <random>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  const size_t Size       = 100000UL;
+  const size_t Iterations = 16UL;
+
+  // The ETL containers are too large for the stack.
+  std::unordered_map<uint64_t, uint16_t>       std_map;
+  etl::unordered_map<uint64_t, uint16_t, Size> etl_map;
+  etl::flat_hash_map<uint64_t, uint16_t, Size> etl_flat_map;
+
+  typedef std::hash<std::string> String_Hash;
+
+  std::unordered_map<std::string, uint16_t>                          std_string_map;
+  etl::unordered_map<std::string, uint16_t, Size, Size, String_Hash> etl_string_map;
+  etl::flat_hash_map<std::string, uint16_t, Size, String_Hash>       etl_flat_string_map;
+
+  //***************************************************************************
+  std::vector<uint64_t> make_sequential_keys(uint64_t first)
+  {
+    std::vector<uint64_t> keys(Size);
+
+    for (size_t i = 0UL; i < Size; ++i)
+    {
+      keys[i] = first + i;
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  std::vector<uint64_t> make_random_keys(uint64_t seed)
+  {
+    std::mt19937_64 urng(seed);
+    std::vector<uint64_t> keys(Size);
+
+    for (size_t i = 0UL; i < Size; ++i)
+    {
+      keys[i] = urng();
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  std::vector<std::string> make_string_keys(const std::string& prefix)
+  {
+    std::vector<std::string> keys(Size);
+
+    for (size_t i = 0UL; i < Size; ++i)
+    {
+      keys[i] = prefix + std::to_string(i);
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  template <typename TMap, typename TKey>
+  void time_map(const std::string& name, TMap& map, const std::vector<TKey>& keys, const std::vector<TKey>& missing_keys)
+  {
+    double insert_ms = 0.0;
+    double find_ms   = 0.0;
+    double miss_ms   = 0.0;
+    double erase_ms  = 0.0;
+    size_t found     = 0UL;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      Stopwatch stopwatch;
+
+      for (size_t j = 0UL; j < keys.size(); ++j)
+      {
+        map.insert(std::make_pair(keys[j], uint16_t(j)));
+      }
+
+      insert_ms += stopwatch.elapsed_ms();
+      stopwatch.start();
+
+      for (size_t j = 0UL; j < keys.size(); ++j)
+      {
+        found += map.count(keys[j]);
+      }
+
+      find_ms += stopwatch.elapsed_ms();
+      stopwatch.start();
+
+      for (size_t j = 0UL; j < missing_keys.size(); ++j)
+      {
+        found += map.count(missing_keys[j]);
+      }
+
+      miss_ms += stopwatch.elapsed_ms();
+      stopwatch.start();
+
+      for (size_t j = 0UL; j < keys.size(); ++j)
+      {
+        map.erase(keys[j]);
+      }
+
+      erase_ms += stopwatch.elapsed_ms();
+    }
+
+    if ((found != (Size * Iterations)) || !map.empty())
+    {
+      std::cout << "*** Incorrect result ***\n";
+    }
+
+    do_not_optimise(found);
+
+    report(name + " insert", insert_ms);
+    report(name + " find",   find_ms);
+    report(name + " miss",   miss_ms);
+    report(name + " erase",  erase_ms);
+  }
+
+  //***************************************************************************
+  void run(const std::string& name, const std::vector<uint64_t>& keys, const std::vector<uint64_t>& missing_keys)
+  {
+    std::cout << "\n" << name << " (" << keys.size() << " keys x " << Iterations << ")\n";
+
+    time_map("  std::unordered_map", std_map,      keys, missing_keys);
+    time_map("  etl::unordered_map", etl_map,      keys, missing_keys);
+    time_map("  etl::flat_hash_map", etl_flat_map, keys, missing_keys);
+  }
+
+  //***************************************************************************
+  void run(const std::string& name, const std::vector<std::string>& keys, const std::vector<std::string>& missing_keys)
+  {
+    std::cout << "\n" << name << " (" << keys.size() << " keys x " << Iterations << ")\n";
+
+    time_map("  std::unordered_map", std_string_map,      keys, missing_keys);
+    time_map("  etl::unordered_map", etl_string_map,      keys, missing_keys);
+    time_map("  etl::flat_hash_map", etl_flat_string_map, keys, missing_keys);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  run("Sequential keys", make_sequential_keys(0U), make_sequential_keys(Size));
+  run("Random keys",     make_random_keys(12345),  make_random_keys(54321));
+  run("String keys",     make_string_keys("key"),  make_string_keys("missing"));
+
+  return 0;
+}
@@ -52,6 +52,8 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_FLAT_SET
 #define ETL_POLYMORPHIC_FLAT_MULTISET
+#define ETL_POLYMORPHIC_FLAT_HASH_MAP
+#define ETL_POLYMORPHIC_FLAT_HASH_SET
 #define ETL_POLYMORPHIC_FORWARD_LIST
 #define ETL_POLYMORPHIC_LIST
 #define ETL_POLYMORPHIC_MAP
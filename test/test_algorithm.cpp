@@ -1108,16 +1108,17 @@ namespace
     {
       std::vector<int> initial_data = { 1, 2, 3, 4, 5, 6, 7 };
 
-      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      for (size_t i = 0UL; i <= initial_data.size(); ++i)
       {
         std::vector<int> data1(initial_data);
         std::vector<int> data2(initial_data);
 
-        std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
-        etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+        int* result1 = std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
+        int* result2 = etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
 
         bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
         CHECK(isEqual);
+        CHECK_EQUAL(std::distance(data1.data(), result1), std::distance(data2.data(), result2));
       }
     }
 
@@ -1127,16 +1128,17 @@ namespace
     {
       std::vector<NDC> initial_data = { NDC(1), NDC(2), NDC(3), NDC(4), NDC(5), NDC(6), NDC(7) };
 
-      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      for (size_t i = 0UL; i <= initial_data.size(); ++i)
       {
         std::vector<NDC> data1(initial_data);
         std::vector<NDC> data2(initial_data);
 
-        std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
-        etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+        NDC* result1 = std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
+        NDC* result2 = etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
 
         bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
         CHECK(isEqual);
+        CHECK_EQUAL(std::distance(data1.data(), result1), std::distance(data2.data(), result2));
       }
     }
 
@@ -1930,6 +1932,109 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_patterns)
+    {
+      const size_t Size = 10000;
+
+      std::vector<int> sorted(Size);
+      std::iota(sorted.begin(), sorted.end(), 0);
+
+      std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+
+      std::vector<int> duplicates(Size);
+      for (size_t i = 0UL; i < Size; ++i)
+      {
+        duplicates[i] = int(urng() % 4);
+      }
+
+      std::vector<int> organ_pipe(Size);
+      for (size_t i = 0UL; i < Size; ++i)
+      {
+        organ_pipe[i] = int((i < (Size / 2)) ? i : Size - i);
+      }
+
+      std::vector<int> all_equal(Size, 42);
+
+      std::vector<std::vector<int>> inputs = { sorted, reversed, duplicates, organ_pipe, all_equal };
+
+      for (size_t i = 0UL; i < inputs.size(); ++i)
+      {
+        std::vector<int> data1 = inputs[i];
+        std::vector<int> data2 = inputs[i];
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_small_ranges)
+    {
+      for (size_t size = 0UL; size < 40UL; ++size)
+      {
+        std::vector<NDC> data1;
+
+        for (size_t i = 0UL; i < size; ++i)
+        {
+          data1.push_back(NDC(int(urng() % 10), int(i)));
+        }
+
+        std::vector<NDC> data2(data1);
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
     //*************************************************************************
     TEST(insertion_sort_default)
     {
@@ -2074,6 +2179,47 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(inplace_merge_default)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(2, 2), NDC(4, 1), NDC(5, 1), NDC(2, 3), NDC(3, 1), NDC(4, 2), NDC(5, 2) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::inplace_merge(data1.begin(), data1.begin() + 5, data1.end());
+      etl::inplace_merge(data2.begin(), data2.begin() + 5, data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(inplace_merge_greater)
+    {
+      std::vector<int> data(100, 0);
+
+      for (size_t middle = 0; middle <= data.size(); ++middle)
+      {
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          data[i] = int((i * 37) % 23);
+        }
+
+        std::sort(data.begin(), data.begin() + middle, std::greater<int>());
+        std::sort(data.begin() + middle, data.end(), std::greater<int>());
+
+        std::vector<int> data1(data);
+        std::vector<int> data2(data);
+
+        std::inplace_merge(data1.begin(), data1.begin() + middle, data1.end(), std::greater<int>());
+        etl::inplace_merge(data2.begin(), data2.begin() + middle, data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
     //*************************************************************************
     TEST(multimax)
     {
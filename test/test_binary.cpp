@@ -1079,6 +1079,46 @@ namespace
     }
 #endif
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros)
+    {
+      // Every single bit, with and without lower bits set.
+      for (int bit = 0; bit < 64; ++bit)
+      {
+        const uint64_t value = uint64_t(1U) << bit;
+
+        CHECK_EQUAL(63 - bit, int(etl::count_leading_zeros(value)));
+        CHECK_EQUAL(63 - bit, int(etl::count_leading_zeros(value | (value - 1U))));
+        CHECK_EQUAL(63 - bit, int(etl::count_leading_zeros(int64_t(value))));
+
+        if (bit < 32)
+        {
+          CHECK_EQUAL(31 - bit, int(etl::count_leading_zeros(uint32_t(value))));
+          CHECK_EQUAL(31 - bit, int(etl::count_leading_zeros(uint32_t(value | (value - 1U)))));
+          CHECK_EQUAL(31 - bit, int(etl::count_leading_zeros(int32_t(value))));
+        }
+
+        if (bit < 16)
+        {
+          CHECK_EQUAL(15 - bit, int(etl::count_leading_zeros(uint16_t(value))));
+          CHECK_EQUAL(15 - bit, int(etl::count_leading_zeros(uint16_t(value | (value - 1U)))));
+          CHECK_EQUAL(15 - bit, int(etl::count_leading_zeros(int16_t(value))));
+        }
+
+        if (bit < 8)
+        {
+          CHECK_EQUAL(7 - bit, int(etl::count_leading_zeros(uint8_t(value))));
+          CHECK_EQUAL(7 - bit, int(etl::count_leading_zeros(uint8_t(value | (value - 1U)))));
+          CHECK_EQUAL(7 - bit, int(etl::count_leading_zeros(int8_t(value))));
+        }
+      }
+
+      CHECK_EQUAL(64, int(etl::count_leading_zeros(uint64_t(0U))));
+      CHECK_EQUAL(32, int(etl::count_leading_zeros(uint32_t(0U))));
+      CHECK_EQUAL(16, int(etl::count_leading_zeros(uint16_t(0U))));
+      CHECK_EQUAL(8,  int(etl::count_leading_zeros(uint8_t(0U))));
+    }
+
     //*************************************************************************
     TEST(test_fold_bits)
     {
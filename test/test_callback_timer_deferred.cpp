@@ -0,0 +1,258 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_deferred.h"
+
+#include <atomic>
+#include <vector>
+#include <thread>
+
+namespace
+{
+  //***************************************************************************
+  class test_object
+  {
+  public:
+
+    void call()
+    {
+      ++called;
+    }
+
+    size_t called = 0UL;
+  };
+
+  SUITE(test_callback_timer_deferred)
+  {
+    //*************************************************************************
+    TEST(deferred_start_applied_on_tick)
+    {
+      test_object object;
+      etl::delegate<void()> callback = etl::delegate<void()>::create<test_object, &test_object::call>(object);
+
+      etl::callback_timer_deferred<2, 4> timer_controller;
+
+      etl::timer_wheel::id::type id = timer_controller.register_timer(callback, 5, etl::timer::mode::REPEATING);
+      CHECK(id != etl::timer_wheel::id::NO_TIMER);
+
+      // Disabled.
+      CHECK(!timer_controller.tick(1));
+
+      timer_controller.enable(true);
+
+      CHECK(timer_controller.start(id));
+      CHECK_EQUAL(0U, object.called);
+
+      // The start is applied at the beginning of the tick.
+      CHECK(timer_controller.tick(4));
+      CHECK_EQUAL(0U, object.called);
+
+      CHECK(timer_controller.tick(1));
+      CHECK_EQUAL(1U, object.called);
+
+      CHECK(timer_controller.tick(10));
+      CHECK_EQUAL(3U, object.called);
+
+      CHECK(timer_controller.stop(id));
+      CHECK(timer_controller.tick(10));
+      CHECK_EQUAL(3U, object.called);
+    }
+
+    //*************************************************************************
+    TEST(deferred_commands_in_order)
+    {
+      test_object object;
+      etl::delegate<void()> callback = etl::delegate<void()>::create<test_object, &test_object::call>(object);
+
+      etl::callback_timer_deferred<2, 8> timer_controller;
+
+      etl::timer_wheel::id::type id = timer_controller.register_timer(callback, 5, etl::timer::mode::SINGLE_SHOT);
+      timer_controller.enable(true);
+
+      // Started, stopped, reconfigured and started again.
+      CHECK(timer_controller.start(id));
+      CHECK(timer_controller.stop(id));
+      CHECK(timer_controller.set_period(id, 3));
+      CHECK(timer_controller.set_mode(id, etl::timer::mode::REPEATING));
+      CHECK(timer_controller.start(id, etl::timer::start::IMMEDIATE));
+
+      CHECK(timer_controller.tick(0));
+      CHECK_EQUAL(1U, object.called);
+
+      CHECK(timer_controller.tick(6));
+      CHECK_EQUAL(3U, object.called);
+    }
+
+    //*************************************************************************
+    TEST(deferred_queue_full_and_invalid_id)
+    {
+      test_object object;
+      etl::delegate<void()> callback = etl::delegate<void()>::create<test_object, &test_object::call>(object);
+
+      etl::callback_timer_deferred<2, 2> timer_controller;
+
+      etl::timer_wheel::id::type id = timer_controller.register_timer(callback, 5, etl::timer::mode::SINGLE_SHOT);
+      timer_controller.enable(true);
+
+      CHECK(!timer_controller.start(2));
+      CHECK(!timer_controller.start(etl::timer_wheel::id::NO_TIMER));
+
+      CHECK(timer_controller.stop(id));
+      CHECK(timer_controller.start(id));
+      CHECK(!timer_controller.stop(id));
+
+      // The tick empties the queue.
+      CHECK(timer_controller.tick(1));
+      CHECK(timer_controller.stop(id));
+      CHECK(timer_controller.start(id));
+
+      // Clear discards the pending commands.
+      timer_controller.clear();
+      CHECK(timer_controller.start(0));
+      CHECK(timer_controller.start(1));
+    }
+
+    //*************************************************************************
+    TEST(deferred_unregister_applies_pending_commands)
+    {
+      test_object object1;
+      test_object object2;
+      etl::delegate<void()> callback1 = etl::delegate<void()>::create<test_object, &test_object::call>(object1);
+      etl::delegate<void()> callback2 = etl::delegate<void()>::create<test_object, &test_object::call>(object2);
+
+      etl::callback_timer_deferred<1, 4> timer_controller;
+      timer_controller.enable(true);
+
+      etl::timer_wheel::id::type id = timer_controller.register_timer(callback1, 5, etl::timer::mode::SINGLE_SHOT);
+      CHECK(timer_controller.start(id));
+      CHECK(timer_controller.unregister_timer(id));
+
+      // The start posted for the old timer must not start the new one.
+      id = timer_controller.register_timer(callback2, 5, etl::timer::mode::SINGLE_SHOT);
+      CHECK(timer_controller.tick(10));
+
+      CHECK_EQUAL(0U, object1.called);
+      CHECK_EQUAL(0U, object2.called);
+    }
+
+    //*************************************************************************
+    TEST(deferred_multiple_producers)
+    {
+      static const uint_least16_t Timers    = 64U;
+      static const size_t         Producers = 4U;
+      static const size_t         Commands  = 20000U;
+
+      std::vector<test_object> objects(Timers);
+      std::vector<etl::delegate<void()>> callbacks;
+      callbacks.reserve(Timers);
+
+      etl::callback_timer_deferred<Timers, 256> timer_controller;
+
+      for (uint_least16_t i = 0U; i < Timers; ++i)
+      {
+        callbacks.push_back(etl::delegate<void()>::create<test_object, &test_object::call>(objects[i]));
+        timer_controller.register_timer(callbacks[i], 3U, etl::timer::mode::REPEATING);
+      }
+
+      timer_controller.enable(true);
+
+      std::atomic<size_t> producers_running(Producers);
+      std::atomic<size_t> posted(0U);
+      bool all_ticks_processed = true;
+
+      // Each producer owns a quarter of the timers and leaves them all stopped.
+      std::vector<std::thread> producers;
+
+      for (size_t p = 0U; p < Producers; ++p)
+      {
+        producers.emplace_back([&, p]()
+        {
+          for (size_t i = 0U; i < Commands; ++i)
+          {
+            const etl::timer_wheel::id::type id = etl::timer_wheel::id::type((p * (Timers / Producers)) + (i % (Timers / Producers)));
+
+            const bool started = ((i / (Timers / Producers)) % 2U) == 0U;
+            bool done;
+
+            do
+            {
+              done = started ? timer_controller.start(id) : timer_controller.stop(id);
+            } while (!done);
+
+            ++posted;
+          }
+
+          for (uint_least16_t i = 0U; i < (Timers / Producers); ++i)
+          {
+            while (!timer_controller.stop(etl::timer_wheel::id::type((p * (Timers / Producers)) + i)))
+            {
+            }
+          }
+
+          --producers_running;
+        });
+      }
+
+      while (producers_running.load() != 0U)
+      {
+        all_ticks_processed = timer_controller.tick(1) && all_ticks_processed;
+      }
+
+      for (size_t p = 0U; p < Producers; ++p)
+      {
+        producers[p].join();
+      }
+
+      CHECK(all_ticks_processed);
+      CHECK_EQUAL(Producers * Commands, posted.load());
+
+      // Apply the final stops, then check that nothing is still running.
+      CHECK(timer_controller.tick(0));
+
+      size_t called = 0U;
+
+      for (uint_least16_t i = 0U; i < Timers; ++i)
+      {
+        called += objects[i].called;
+      }
+
+      CHECK(timer_controller.tick(100));
+
+      size_t called_after = 0U;
+
+      for (uint_least16_t i = 0U; i < Timers; ++i)
+      {
+        called_after += objects[i].called;
+      }
+
+      CHECK_EQUAL(called, called_after);
+    }
+  };
+}
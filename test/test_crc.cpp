@@ -57,6 +57,95 @@ SOFTWARE.
 
 namespace
 {
+  //*************************************************************************
+  // Compares a CRC table option with the 256 entry table for many lengths and alignments.
+  //*************************************************************************
+  template <typename TCrcParameters, size_t Table_Size>
+  bool matches_256_table()
+  {
+    typedef etl::crc_type<TCrcParameters, 256U>       table_crc_t;
+    typedef etl::crc_type<TCrcParameters, Table_Size> test_crc_t;
+
+    std::vector<uint8_t> data(600U);
+
+    uint32_t seed = 0x12345678UL;
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      seed = (seed * 1103515245UL) + 12345UL;
+      data[i] = uint8_t(seed >> 16U);
+    }
+
+    for (size_t offset = 0UL; offset < 8UL; ++offset)
+    {
+      for (size_t length = 0UL; length < (data.size() - offset); length += ((length < 300UL) ? 1UL : 37UL))
+      {
+        const uint8_t* begin = data.data() + offset;
+        const uint8_t* end   = begin + length;
+
+        if (table_crc_t(begin, end).value() != test_crc_t(begin, end).value())
+        {
+          return false;
+        }
+      }
+    }
+
+    // Byte by byte, then a block.
+    test_crc_t  test;
+    table_crc_t table;
+
+    for (size_t i = 0UL; i < 3UL; ++i)
+    {
+      test.add(data[i]);
+      table.add(data[i]);
+    }
+
+    test.add(data.begin() + 3U, data.end());
+    table.add(data.begin() + 3U, data.end());
+
+    return table.value() == test.value();
+  }
+
+  //*************************************************************************
+  template <typename TCrcParameters>
+  bool all_match_256_table()
+  {
+    return matches_256_table<TCrcParameters, etl::crc_slicing_by_4>()  &&
+           matches_256_table<TCrcParameters, etl::crc_slicing_by_8>()  &&
+           matches_256_table<TCrcParameters, etl::crc_slicing_by_16>() &&
+           matches_256_table<TCrcParameters, etl::crc_accelerated>();
+  }
+
+  //*************************************************************************
+  // Checks that combining the CRCs of two blocks gives the CRC of both.
+  //*************************************************************************
+  template <typename TCrcParameters>
+  bool combine_matches()
+  {
+    typedef etl::crc_type<TCrcParameters, 256U> crc_t;
+
+    std::vector<uint8_t> data(300U);
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 31U) + 7U);
+    }
+
+    for (size_t split = 0UL; split <= data.size(); split += 13UL)
+    {
+      typename crc_t::value_type crc1 = crc_t(data.begin(), data.begin() + split).value();
+      typename crc_t::value_type crc2 = crc_t(data.begin() + split, data.end()).value();
+      typename crc_t::value_type crc  = crc_t(data.begin(), data.end()).value();
+
+      if (etl::crc_combine<crc_t>(crc1, crc2, data.size() - split) != crc)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_crc)
   {
     //*************************************************************************
@@ -1253,6 +1342,127 @@ namespace
       uint64_t crc3 = etl::crc64_ecma(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc_slicing_and_accelerated_match_table)
+    {
+      using namespace etl::private_crc;
+
+      CHECK(all_match_256_table<crc8_ccitt_parameters>());
+      CHECK(all_match_256_table<crc8_rohc_parameters>());
+      CHECK(all_match_256_table<crc8_cdma2000_parameters>());
+      CHECK(all_match_256_table<crc8_darc_parameters>());
+      CHECK(all_match_256_table<crc8_dvbs2_parameters>());
+      CHECK(all_match_256_table<crc8_ebu_parameters>());
+      CHECK(all_match_256_table<crc8_icode_parameters>());
+      CHECK(all_match_256_table<crc8_itu_parameters>());
+      CHECK(all_match_256_table<crc8_maxim_parameters>());
+      CHECK(all_match_256_table<crc8_wcdma_parameters>());
+      CHECK(all_match_256_table<crc16_parameters>());
+      CHECK(all_match_256_table<crc16_ccitt_parameters>());
+      CHECK(all_match_256_table<crc16_aug_ccitt_parameters>());
+      CHECK(all_match_256_table<crc16_buypass_parameters>());
+      CHECK(all_match_256_table<crc16_genibus_parameters>());
+      CHECK(all_match_256_table<crc16_profibus_parameters>());
+      CHECK(all_match_256_table<crc16_kermit_parameters>());
+      CHECK(all_match_256_table<crc16_modbus_parameters>());
+      CHECK(all_match_256_table<crc16_usb_parameters>());
+      CHECK(all_match_256_table<crc16_x25_parameters>());
+      CHECK(all_match_256_table<crc16_xmodem_parameters>());
+      CHECK(all_match_256_table<crc16_cdma2000_parameters>());
+      CHECK(all_match_256_table<crc16_dds110_parameters>());
+      CHECK(all_match_256_table<crc16_dect_r_parameters>());
+      CHECK(all_match_256_table<crc16_dect_x_parameters>());
+      CHECK(all_match_256_table<crc16_dnp_parameters>());
+      CHECK(all_match_256_table<crc16_en13757_parameters>());
+      CHECK(all_match_256_table<crc16_maxim_parameters>());
+      CHECK(all_match_256_table<crc16_mcrf4xx_parameters>());
+      CHECK(all_match_256_table<crc16_riello_parameters>());
+      CHECK(all_match_256_table<crc16_t10dif_parameters>());
+      CHECK(all_match_256_table<crc16_teledisk_parameters>());
+      CHECK(all_match_256_table<crc16_tms37157_parameters>());
+      CHECK(all_match_256_table<crc16_a_parameters>());
+      CHECK(all_match_256_table<crc16_arc_parameters>());
+      CHECK(all_match_256_table<crc32_parameters>());
+      CHECK(all_match_256_table<crc32_c_parameters>());
+      CHECK(all_match_256_table<crc32_bzip2_parameters>());
+      CHECK(all_match_256_table<crc32_mpeg2_parameters>());
+      CHECK(all_match_256_table<crc32_posix_parameters>());
+      CHECK(all_match_256_table<crc32_d_parameters>());
+      CHECK(all_match_256_table<crc32_q_parameters>());
+      CHECK(all_match_256_table<crc32_jamcrc_parameters>());
+      CHECK(all_match_256_table<crc32_xfer_parameters>());
+      CHECK(all_match_256_table<crc64_ecma_parameters>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine)
+    {
+      using namespace etl::private_crc;
+
+      CHECK(combine_matches<crc8_ccitt_parameters>());
+      CHECK(combine_matches<crc8_rohc_parameters>());
+      CHECK(combine_matches<crc8_cdma2000_parameters>());
+      CHECK(combine_matches<crc8_darc_parameters>());
+      CHECK(combine_matches<crc8_dvbs2_parameters>());
+      CHECK(combine_matches<crc8_ebu_parameters>());
+      CHECK(combine_matches<crc8_icode_parameters>());
+      CHECK(combine_matches<crc8_itu_parameters>());
+      CHECK(combine_matches<crc8_maxim_parameters>());
+      CHECK(combine_matches<crc8_wcdma_parameters>());
+      CHECK(combine_matches<crc16_parameters>());
+      CHECK(combine_matches<crc16_ccitt_parameters>());
+      CHECK(combine_matches<crc16_aug_ccitt_parameters>());
+      CHECK(combine_matches<crc16_buypass_parameters>());
+      CHECK(combine_matches<crc16_genibus_parameters>());
+      CHECK(combine_matches<crc16_profibus_parameters>());
+      CHECK(combine_matches<crc16_kermit_parameters>());
+      CHECK(combine_matches<crc16_modbus_parameters>());
+      CHECK(combine_matches<crc16_usb_parameters>());
+      CHECK(combine_matches<crc16_x25_parameters>());
+      CHECK(combine_matches<crc16_xmodem_parameters>());
+      CHECK(combine_matches<crc16_cdma2000_parameters>());
+      CHECK(combine_matches<crc16_dds110_parameters>());
+      CHECK(combine_matches<crc16_dect_r_parameters>());
+      CHECK(combine_matches<crc16_dect_x_parameters>());
+      CHECK(combine_matches<crc16_dnp_parameters>());
+      CHECK(combine_matches<crc16_en13757_parameters>());
+      CHECK(combine_matches<crc16_maxim_parameters>());
+      CHECK(combine_matches<crc16_mcrf4xx_parameters>());
+      CHECK(combine_matches<crc16_riello_parameters>());
+      CHECK(combine_matches<crc16_t10dif_parameters>());
+      CHECK(combine_matches<crc16_teledisk_parameters>());
+      CHECK(combine_matches<crc16_tms37157_parameters>());
+      CHECK(combine_matches<crc16_a_parameters>());
+      CHECK(combine_matches<crc16_arc_parameters>());
+      CHECK(combine_matches<crc32_parameters>());
+      CHECK(combine_matches<crc32_c_parameters>());
+      CHECK(combine_matches<crc32_bzip2_parameters>());
+      CHECK(combine_matches<crc32_mpeg2_parameters>());
+      CHECK(combine_matches<crc32_posix_parameters>());
+      CHECK(combine_matches<crc32_d_parameters>());
+      CHECK(combine_matches<crc32_q_parameters>());
+      CHECK(combine_matches<crc32_jamcrc_parameters>());
+      CHECK(combine_matches<crc32_xfer_parameters>());
+      CHECK(combine_matches<crc64_ecma_parameters>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_typedefs)
+    {
+      std::string data1("12345");
+      std::string data2("6789");
+
+      uint32_t crc1 = etl::crc32_c(data1.begin(), data1.end());
+      uint32_t crc2 = etl::crc32_c(data2.begin(), data2.end());
+
+      CHECK_EQUAL(0xE3069283UL, etl::crc_combine<etl::crc32_c>(crc1, crc2, data2.size()));
+
+      uint64_t crc3 = etl::crc64_ecma(data1.begin(), data1.end());
+      uint64_t crc4 = etl::crc64_ecma(data2.begin(), data2.end());
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, etl::crc_combine<etl::crc64_ecma>(crc3, crc4, data2.size()));
+    }
   };
 }
 
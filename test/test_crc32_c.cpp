@@ -258,6 +258,52 @@ namespace
       uint32_t crc3 = etl::crc32_c_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+    //*************************************************************************
+    TEST(test_crc32_c_accelerated_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c_accelerated crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_accelerated_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c_accelerated crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + data.size());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_accelerated_add_large_range)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 7U);
+      }
+
+      uint32_t crc1 = etl::crc32_c(data.begin(), data.end());
+      uint32_t crc2 = etl::crc32_c_accelerated(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(crc1, crc2);
+    }
   };
 }
 
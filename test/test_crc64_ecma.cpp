@@ -258,6 +258,52 @@ namespace
       uint64_t crc3 = etl::crc64_ecma_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+    //*************************************************************************
+    TEST(test_crc64_ecma_accelerated_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_accelerated crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint64_t crc = crc_calculator;
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_accelerated_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_accelerated crc_calculator;
+
+      crc_calculator.add(data.data(), data.data() + data.size());
+
+      uint64_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_accelerated_add_large_range)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 7U);
+      }
+
+      uint64_t crc1 = etl::crc64_ecma(data.begin(), data.end());
+      uint64_t crc2 = etl::crc64_ecma_accelerated(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(crc1, crc2);
+    }
   };
 }
 
@@ -0,0 +1,105 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc_parallel.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+
+namespace
+{
+  //*************************************************************************
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+
+    uint32_t seed = 0x9E3779B9UL;
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      seed = (seed * 1664525UL) + 1013904223UL;
+      data[i] = uint8_t(seed >> 24U);
+    }
+
+    return data;
+  }
+
+  SUITE(test_crc_parallel)
+  {
+    //*************************************************************************
+    TEST(test_crc32_parallel)
+    {
+      std::vector<uint8_t> data = make_data((4U * etl::crc_parallel_minimum_block) + 123U);
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      for (size_t n_threads = 1U; n_threads <= 6U; ++n_threads)
+      {
+        CHECK_EQUAL(expected, etl::crc_parallel<etl::crc32>(data.data(), data.data() + data.size(), n_threads));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_accelerated_parallel)
+    {
+      std::vector<uint8_t> data = make_data((3U * etl::crc_parallel_minimum_block) + 7U);
+
+      uint32_t expected = etl::crc32_c(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, etl::crc_parallel<etl::crc32_c_accelerated>(data.data(), data.data() + data.size(), 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_parallel)
+    {
+      std::vector<uint8_t> data = make_data((2U * etl::crc_parallel_minimum_block) + 1U);
+
+      uint64_t expected = etl::crc64_ecma(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, etl::crc_parallel<etl::crc64_ecma_t<etl::crc_slicing_by_16> >(data.data(), data.data() + data.size(), 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_parallel_small_and_empty)
+    {
+      std::vector<uint8_t> data = make_data(100U);
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, etl::crc_parallel<etl::crc32>(data.data(), data.data() + data.size(), 4U));
+      CHECK_EQUAL(uint32_t(etl::crc32().value()), etl::crc_parallel<etl::crc32>(data.data(), data.data(), 4U));
+      CHECK_EQUAL(expected, etl::crc_parallel<etl::crc32>(data.data(), data.data() + data.size(), 0U));
+    }
+  };
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <set>
+
+#include "etl/fixed_sized_memory_block_allocator_atomic.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+namespace
+{
+  using Allocator16 = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int16_t), alignof(int16_t), 4>;
+  using Allocator32 = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int32_t), alignof(int32_t), 4>;
+
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  SUITE(test_fixed_sized_memory_block_allocator_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocator_no_successor_use_all_allocation)
+    {
+      Allocator16 allocator16;
+
+      int16_t* p1 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p2 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p3 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p4 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p5 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+      CHECK(p5 == nullptr);
+
+      std::set<int16_t*> unique = { p1, p2, p3, p4 };
+      CHECK_EQUAL(4U, unique.size());
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+      CHECK(allocator16.release(p3));
+      CHECK(allocator16.release(p4));
+      CHECK(!allocator16.release(p5));
+
+      // All of them are available again.
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) != nullptr);
+      }
+
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int16_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_rejects_foreign_and_oversized)
+    {
+      Allocator16 allocator16;
+      int16_t     other;
+
+      CHECK(allocator16.allocate(sizeof(int32_t), alignof(int16_t)) == nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int32_t) * 2U) == nullptr);
+      CHECK(!allocator16.release(&other));
+
+      char* p = static_cast<char*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      CHECK(!allocator16.release(p + 1));
+      CHECK(allocator16.release(p));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_with_successor)
+    {
+      Allocator16 allocator16;
+      Allocator32 allocator32;
+
+      allocator16.set_successor(allocator32);
+
+      void* p[9];
+
+      for (int i = 0; i < 9; ++i)
+      {
+        p[i] = allocator16.allocate(sizeof(int16_t), alignof(int16_t));
+      }
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(allocator16.is_owner_of(p[i]));
+      }
+
+      for (int i = 4; i < 8; ++i)
+      {
+        CHECK(allocator32.is_owner_of(p[i]));
+      }
+
+      CHECK(p[8] == nullptr);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(allocator16.release(p[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_message_pool_without_lock_from_threads)
+    {
+      static const int Threads    = 4;
+      static const int Iterations = 20000;
+
+      using parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1>;
+
+      etl::fixed_sized_memory_block_allocator_atomic<parameters::max_size, parameters::max_alignment, 8U> allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      std::vector<std::thread> threads;
+      std::vector<int>         errors(Threads, 0);
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&pool, &errors, t]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            const int value = (t * Iterations) + i;
+
+            // The pool may briefly be empty.
+            etl::reference_counted_message<Message1, etl::atomic_int>* p = nullptr;
+
+            while (p == nullptr)
+            {
+              try
+              {
+                p = pool.allocate(Message1(value));
+              }
+              catch (...)
+              {
+                std::this_thread::yield();
+              }
+            }
+
+            etl::shared_message sm(*p);
+
+            // No other thread has the same block.
+            if (static_cast<const Message1&>(sm.get_message()).i != value)
+            {
+              ++errors[t];
+            }
+          }
+        });
+      }
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        CHECK_EQUAL(0, errors[t]);
+      }
+
+      // Every block was returned.
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(allocator.allocate(parameters::max_size, parameters::max_alignment) != nullptr);
+      }
+
+      CHECK(allocator.allocate(parameters::max_size, parameters::max_alignment) == nullptr);
+    }
+  };
+}
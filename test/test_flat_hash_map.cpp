@@ -0,0 +1,1112 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <sstream>
+
+#include <map>
+#include <array>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <functional>
+
+#include "data.h"
+
+#include "etl/flat_hash_map.h"
+#include "etl/hash.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  /// Keys below 1000 share home slot 0 and tag 0.
+  /// Other keys have the hash in 'other_key_hash'.
+  size_t other_key_hash = 0U;
+
+  struct cluster_hash
+  {
+    size_t operator ()(int key) const
+    {
+      return (key < 1000) ? 0U : other_key_hash;
+    }
+  };
+
+  //*************************************************************************
+  /// Counts the comparisons with the key 'dead_key', once it has been erased.
+  int dead_key = -1;
+  int dead_key_compares = 0;
+
+  struct counting_key_equal
+  {
+    bool operator ()(int lhs, int rhs) const
+    {
+      if ((lhs == dead_key) || (rhs == dead_key))
+      {
+        ++dead_key_compares;
+      }
+
+      return lhs == rhs;
+    }
+  };
+
+  typedef TestDataDC<std::string>  DC;
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef ETL_OR_STD::pair<std::string, DC>  ElementDC;
+  typedef ETL_OR_STD::pair<std::string, NDC> ElementNDC;
+}
+
+namespace etl
+{
+  template <>
+  struct hash<std::string>
+  {
+    size_t operator ()(const std::string& e) const
+    {
+      size_t sum = 0U;
+      return std::accumulate(e.begin(), e.end(), sum);
+    }
+  };
+}
+
+namespace
+{
+  SUITE(test_flat_hash_map)
+  {
+    static const size_t SIZE = 10;
+
+    using ItemM = TestDataM<int>;
+    using DataM = etl::flat_hash_map<std::string, ItemM, SIZE, std::hash<std::string>>;
+
+    typedef etl::flat_hash_map<std::string, DC,  SIZE, simple_hash> DataDC;
+    typedef etl::flat_hash_map<std::string, NDC, SIZE, simple_hash> DataNDC;
+    typedef etl::iflat_hash_map<std::string, NDC, simple_hash> IDataNDC;
+
+    NDC N0 = NDC("A");
+    NDC N1 = NDC("B");
+    NDC N2 = NDC("C");
+    NDC N3 = NDC("D");
+    NDC N4 = NDC("E");
+    NDC N5 = NDC("F");
+    NDC N6 = NDC("G");
+    NDC N7 = NDC("H");
+    NDC N8 = NDC("I");
+    NDC N9 = NDC("J");
+    NDC N10 = NDC("K");
+    NDC N11 = NDC("L");
+    NDC N12 = NDC("M");
+    NDC N13 = NDC("N");
+    NDC N14 = NDC("O");
+    NDC N15 = NDC("P");
+    NDC N16 = NDC("Q");
+    NDC N17 = NDC("R");
+    NDC N18 = NDC("S");
+    NDC N19 = NDC("T");
+
+    DC M0 = DC("A");
+    DC M1 = DC("B");
+    DC M2 = DC("C");
+    DC M3 = DC("D");
+    DC M4 = DC("E");
+    DC M5 = DC("F");
+    DC M6 = DC("G");
+    DC M7 = DC("H");
+    DC M8 = DC("I");
+    DC M9 = DC("J");
+    DC M10 = DC("K");
+    DC M11 = DC("L");
+    DC M12 = DC("M");
+    DC M13 = DC("N");
+    DC M14 = DC("O");
+    DC M15 = DC("P");
+    DC M16 = DC("Q");
+    DC M17 = DC("R");
+    DC M18 = DC("S");
+    DC M19 = DC("T");
+
+    const char* K0  = "FF"; // 0
+    const char* K1  = "FG"; // 1
+    const char* K2  = "FH"; // 2
+    const char* K3  = "FI"; // 3
+    const char* K4  = "FJ"; // 4
+    const char* K5  = "FK"; // 5
+    const char* K6  = "FL"; // 6
+    const char* K7  = "FM"; // 7
+    const char* K8  = "FN"; // 8
+    const char* K9  = "FO"; // 9
+    const char* K10 = "FP"; // 0
+    const char* K11 = "FQ"; // 1
+    const char* K12 = "FR"; // 2
+    const char* K13 = "FS"; // 3
+    const char* K14 = "FT"; // 4
+    const char* K15 = "FU"; // 5
+    const char* K16 = "FV"; // 6
+    const char* K17 = "FW"; // 7
+    const char* K18 = "FX"; // 8
+    const char* K19 = "FY"; // 9
+
+    std::string K[] = { K0, K1, K2, K3, K4, K5, K6, K7, K8, K9, K10, K11, K12, K13, K14, K15, K16, K17, K18, K19 };
+
+    std::vector<ElementDC> initial_data_dc;
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+    std::vector<ElementNDC> different_data;
+
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+    {
+      while (begin1 != end1)
+      {
+        if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+        {
+          return false;
+        }
+
+        ++begin1;
+        ++begin2;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9)
+        };
+
+        ElementNDC n2[] =
+        {
+          ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9),
+          ElementNDC(K10, N10)
+        };
+
+        ElementNDC n3[] =
+        {
+          ElementNDC(K10, N10), ElementNDC(K11, N11), ElementNDC(K12, N12), ElementNDC(K13, N13), ElementNDC(K14, N14),
+          ElementNDC(K15, N15), ElementNDC(K16, N16), ElementNDC(K17, N17), ElementNDC(K18, N18), ElementNDC(K19, N19)
+        };
+
+        ElementDC n4[] =
+        {
+          ElementDC(K0, M0), ElementDC(K1, M1), ElementDC(K2, M2), ElementDC(K3, M3), ElementDC(K4, M4),
+          ElementDC(K5, M5), ElementDC(K6, M6), ElementDC(K7, M7), ElementDC(K8, M8), ElementDC(K9, M9)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n2), std::end(n2));
+        different_data.assign(std::begin(n3), std::end(n3));
+        initial_data_dc.assign(std::begin(n4), std::end(n4));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataDC data;
+
+      CHECK_EQUAL(data.size(), size_t(0));
+      CHECK(data.empty());
+      CHECK_EQUAL(data.max_size(), SIZE);
+      CHECK(data.begin() == data.end());
+    }
+
+#if ETL_USING_STL && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    //*************************************************************************
+    TEST(test_cpp17_deduced_constructor)
+    {
+      etl::flat_hash_map data{ ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+                               ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9) };
+      etl::flat_hash_map<std::string, NDC, 10U> check = { ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+                                                               ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9) };
+
+      CHECK(!data.empty());
+      CHECK(data.full());
+      CHECK(data.begin() != data.end());
+      CHECK_EQUAL(10U, data.size());
+      CHECK_EQUAL(0U, data.available());
+      CHECK_EQUAL(10U, data.capacity());
+      CHECK_EQUAL(10U, data.max_size());
+      CHECK(data == check);
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataDC data(initial_data_dc.begin(), initial_data_dc.end());
+
+      CHECK(data.size() == SIZE);
+      CHECK(!data.empty());
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      DataM data1;
+
+      ItemM d1(1);
+      ItemM d2(2);
+      ItemM d3(3);
+
+      data1.insert(DataM::value_type(std::string("1"), etl::move(d1)));
+      data1.insert(DataM::value_type(std::string("2"), etl::move(d2)));
+      data1.insert(DataM::value_type(std::string("3"), etl::move(d3)));
+      data1.insert(DataM::value_type(std::string("4"), ItemM(4)));
+
+      DataM data2(std::move(data1));
+
+      CHECK(!data1.empty()); // Move does not clear the source.
+
+      CHECK_EQUAL(1, data2.at("1").value);
+      CHECK_EQUAL(2, data2.at("2").value);
+      CHECK_EQUAL(3, data2.at("3").value);
+      CHECK_EQUAL(4, data2.at("4").value);
+    }
+
+    //*************************************************************************
+    TEST(test_destruct_via_iflat_hash_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(initial_data.begin(), initial_data.end());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data;
+
+      other_data = data;
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                other_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      bool isEqual = std::equal(data1.begin(),
+                                data1.end(),
+                                data2.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_self_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data(data);
+
+      other_data = other_data;
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                other_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_assignment)
+    {
+      DataM data1;
+      DataM data2;
+
+      ItemM d1(1);
+      ItemM d2(2);
+      ItemM d3(3);
+
+      data1.insert(DataM::value_type(std::string("1"), etl::move(d1)));
+      data1.insert(DataM::value_type(std::string("2"), etl::move(d2)));
+      data1.insert(DataM::value_type(std::string("3"), etl::move(d3)));
+      data1.insert(DataM::value_type(std::string("4"), ItemM(4)));
+
+      data2 = std::move(data1);
+
+      CHECK_EQUAL(1, data2.at("1").value);
+      CHECK_EQUAL(2, data2.at("2").value);
+      CHECK_EQUAL(3, data2.at("3").value);
+      CHECK_EQUAL(4, data2.at("4").value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_empty_full)
+    {
+      DataNDC data;
+
+      CHECK(!data.full());
+      CHECK(data.empty());
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(!data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read)
+    {
+      DataDC data(initial_data_dc.begin(), initial_data_dc.end());
+
+      CHECK_EQUAL(M0, data[K0]);
+      CHECK_EQUAL(M1, data[K1]);
+      CHECK_EQUAL(M2, data[K2]);
+      CHECK_EQUAL(M3, data[K3]);
+      CHECK_EQUAL(M4, data[K4]);
+      CHECK_EQUAL(M5, data[K5]);
+      CHECK_EQUAL(M6, data[K6]);
+      CHECK_EQUAL(M7, data[K7]);
+      CHECK_EQUAL(M8, data[K8]);
+      CHECK_EQUAL(M9, data[K9]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_write)
+    {
+      DataDC data(initial_data_dc.begin(), initial_data_dc.end());
+
+      data[K0] = M9;
+      data[K1] = M8;
+      data[K2] = M7;
+      data[K3] = M6;
+      data[K4] = M5;
+      data[K5] = M4;
+      data[K6] = M3;
+      data[K7] = M2;
+      data[K8] = M1;
+      data[K9] = M0;
+
+      CHECK_EQUAL(M9, data[K0]);
+      CHECK_EQUAL(M8, data[K1]);
+      CHECK_EQUAL(M7, data[K2]);
+      CHECK_EQUAL(M6, data[K3]);
+      CHECK_EQUAL(M5, data[K4]);
+      CHECK_EQUAL(M4, data[K5]);
+      CHECK_EQUAL(M3, data[K6]);
+      CHECK_EQUAL(M2, data[K7]);
+      CHECK_EQUAL(M1, data[K8]);
+      CHECK_EQUAL(M0, data[K9]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(data.at(K0), N0);
+      CHECK_EQUAL(data.at(K1), N1);
+      CHECK_EQUAL(data.at(K2), N2);
+      CHECK_EQUAL(data.at(K3), N3);
+      CHECK_EQUAL(data.at(K4), N4);
+      CHECK_EQUAL(data.at(K5), N5);
+      CHECK_EQUAL(data.at(K6), N6);
+      CHECK_EQUAL(data.at(K7), N7);
+      CHECK_EQUAL(data.at(K8), N8);
+      CHECK_EQUAL(data.at(K9), N9);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at_const)
+    {
+      const DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(data.at(K0), N0);
+      CHECK_EQUAL(data.at(K1), N1);
+      CHECK_EQUAL(data.at(K2), N2);
+      CHECK_EQUAL(data.at(K3), N3);
+      CHECK_EQUAL(data.at(K4), N4);
+      CHECK_EQUAL(data.at(K5), N5);
+      CHECK_EQUAL(data.at(K6), N6);
+      CHECK_EQUAL(data.at(K7), N7);
+      CHECK_EQUAL(data.at(K8), N8);
+      CHECK_EQUAL(data.at(K9), N9);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_range)
+    {
+      DataNDC data;
+
+      data.assign(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator idata;
+
+      for (size_t i = 0UL; i < 10; ++i)
+      {
+        idata = data.find(K[i]);
+        CHECK(idata != data.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      data.insert(DataNDC::value_type(K0,  N0)); // Inserted
+      data.insert(DataNDC::value_type(K2,  N2)); // Inserted
+      data.insert(DataNDC::value_type(K1,  N1)); // Inserted
+      data.insert(DataNDC::value_type(K11, N1)); // Duplicate hash. Inserted
+      data.insert(DataNDC::value_type(K1,  N3)); // Duplicate key.  Not inserted
+
+      CHECK_EQUAL(4U, data.size());
+
+      DataNDC::iterator idata;
+
+      idata = data.find(K0);
+      CHECK(idata != data.end());
+      CHECK(idata->first  == K0);
+      CHECK(idata->second == N0);
+
+      idata = data.find(K1);
+      CHECK(idata != data.end());
+      CHECK(idata->first  == K1);
+      CHECK(idata->second == N1);
+
+      idata = data.find(K2);
+      CHECK(idata != data.end());
+      CHECK(idata->first  == K2);
+      CHECK(idata->second == N2);
+
+      idata = data.find(K11);
+      CHECK(idata != data.end());
+      CHECK(idata->first  == K11);
+      CHECK(idata->second == N1);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(ETL_OR_STD::make_pair(K10, N10)), etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range)
+    {
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        DataNDC::iterator idata = data.find(initial_data[i].first);
+        CHECK(idata != data.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_moved_value)
+    {
+      DataM data;
+
+      ItemM d1(1);
+      ItemM d2(2);
+      ItemM d3(3);
+
+      data.insert(DataM::value_type(std::string("1"), etl::move(d1)));
+      data.insert(DataM::value_type(std::string("2"), etl::move(d2)));
+      data.insert(DataM::value_type(std::string("3"), etl::move(d3)));
+      data.insert(DataM::value_type(std::string("4"), ItemM(4)));
+
+      CHECK(!bool(d1));
+      CHECK(!bool(d2));
+      CHECK(!bool(d3));
+
+      CHECK_EQUAL(1, data.at("1").value);
+      CHECK_EQUAL(2, data.at("2").value);
+      CHECK_EQUAL(3, data.at("3").value);
+      CHECK_EQUAL(4, data.at("4").value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      size_t count = data.erase(K5);
+
+      CHECK_EQUAL(1U, count);
+
+      DataNDC::iterator idata = data.find(K5);
+      CHECK(idata == data.end());
+
+      // Test that erase really does erase from the pool.
+      CHECK(!data.full());
+      CHECK(!data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_single)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::const_iterator idata = data.find(K5);
+      DataNDC::const_iterator inext = idata;
+      ++inext;
+
+      DataNDC::const_iterator iafter = data.erase(idata);
+      idata = data.find(K5);
+
+      CHECK(idata == data.end());
+      CHECK(inext == iafter);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator idata     = data.begin();
+      std::advance(idata, 2);
+
+      DataNDC::iterator idata_end = data.begin();
+      std::advance(idata_end, 5);
+
+      std::vector<std::string> erased;
+      std::vector<std::string> kept;
+
+      for (DataNDC::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        size_t index = std::distance(data.begin(), itr);
+
+        if ((index >= 2) && (index < 5))
+        {
+          erased.push_back(itr->first);
+        }
+        else
+        {
+          kept.push_back(itr->first);
+        }
+      }
+
+      std::string next = idata_end->first;
+
+      DataNDC::iterator inext = data.erase(idata, idata_end);
+
+      CHECK_EQUAL(initial_data.size() - 3, data.size());
+      CHECK(!data.full());
+      CHECK(!data.empty());
+      CHECK_EQUAL(next, inext->first);
+
+      for (size_t i = 0UL; i < erased.size(); ++i)
+      {
+        CHECK(data.find(erased[i]) == data.end());
+      }
+
+      for (size_t i = 0UL; i < kept.size(); ++i)
+      {
+        CHECK(data.find(kept[i]) != data.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range_first_half)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator end = data.begin();
+      etl::advance(end, data.size() / 2);
+
+      auto itr = data.erase(data.begin(), end);
+
+      CHECK_EQUAL(initial_data.size() / 2, data.size());
+      CHECK(!data.full());
+      CHECK(!data.empty());
+      CHECK(itr == end);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range_last_half)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator begin = data.begin();
+      etl::advance(begin, data.size() / 2);
+
+      auto itr = data.erase(begin, data.end());
+
+      CHECK_EQUAL(initial_data.size() / 2, data.size());
+      CHECK(!data.full());
+      CHECK(!data.empty());
+      CHECK(itr == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range_all)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      auto itr = data.erase(data.begin(), data.end());
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(!data.full());
+      CHECK(data.empty());
+      CHECK(itr == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      data.clear();
+
+      CHECK_EQUAL(data.size(), size_t(0));
+    }
+
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_count_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      size_t count = data.count(K5);
+      CHECK_EQUAL(1U, count);
+
+      count = data.count(K12);
+      CHECK_EQUAL(0U, count);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator> result;
+
+      for (size_t i = 0UL; i < 10; ++i)
+      {
+        result = data.equal_range(K[i]);
+        CHECK(result.first == data.find(K[i]));
+        CHECK_EQUAL(std::distance(result.first, result.second), 1);
+        CHECK_EQUAL(result.first->first, K[i]);
+      }
+
+      result = data.equal_range(K10);
+      CHECK(result.first  == data.end());
+      CHECK(result.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range_const)
+    {
+      const DataNDC data(initial_data.begin(), initial_data.end());
+
+      ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> result;
+
+      for (size_t i = 0UL; i < 10; ++i)
+      {
+        result = data.equal_range(K[i]);
+        CHECK(result.first == data.find(K[i]));
+        CHECK_EQUAL(std::distance(result.first, result.second), 1);
+        CHECK_EQUAL(result.first->first, K[i]);
+      }
+
+      result = data.equal_range(K10);
+      CHECK(result.first  == data.end());
+      CHECK(result.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      const DataNDC initial1(initial_data.begin(), initial_data.end());
+      const DataNDC initial2(initial_data.begin(), initial_data.end());
+
+      CHECK(initial1 == initial2);
+
+      const DataNDC different(different_data.begin(), different_data.end());
+
+      CHECK(!(initial1 == different));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_not_equal)
+    {
+      const DataNDC initial1(initial_data.begin(), initial_data.end());
+      const DataNDC initial2(initial_data.begin(), initial_data.end());
+
+      CHECK(!(initial1 != initial2));
+
+      const DataNDC different(different_data.begin(), different_data.end());
+
+      CHECK(initial1 != different);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_hash_function)
+    {
+      DataNDC data;
+      DataNDC::hasher hash_function =  data.hash_function();
+
+      CHECK_EQUAL(simple_hash()(std::string("ABCDEF")), hash_function(std::string("ABCDEF")));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_key_eq_function)
+    {
+      DataNDC data;
+      DataNDC::key_equal key_eq = data.key_eq();
+
+      CHECK(key_eq(std::string("ABCDEF"), std::string("ABCDEF")));
+      CHECK(!key_eq(std::string("ABCDEF"), std::string("ABCDEG")));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_load_factor)
+    {
+      // Empty.
+      DataNDC data;
+      CHECK_CLOSE(0.0, data.load_factor(), 0.01);
+
+      // A quarter of the capacity used.
+      data.assign(initial_data.begin(), initial_data.begin() + (initial_data.size() / 4));
+      CHECK_CLOSE(2.0 / data.bucket_count(), data.load_factor(), 0.01);
+
+      // All of the capacity used.
+      data.assign(initial_data.begin(), initial_data.end());
+      CHECK_CLOSE(10.0 / data.bucket_count(), data.load_factor(), 0.01);
+      CHECK(data.load_factor() < 1.0);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_and_erase_bug)
+    {
+      etl::flat_hash_map<uint32_t, char, 5> map;
+
+      map[1] = 'b';
+      map[2] = 'c';
+      map[3] = 'd';
+      map[4] = 'e';
+
+      auto it = map.find(1);
+      map.erase(it);
+
+      it = map.find(4);
+      map.erase(it);
+
+      std::vector<std::string> s;
+
+      for (const auto &kv : map)
+      {
+        std::stringstream ss;
+        ss << "map[" << kv.first << "] = " << kv.second;
+        s.push_back(ss.str());
+      }
+
+      std::sort(s.begin(), s.end());
+
+      CHECK_EQUAL(2, s.size());
+      CHECK_EQUAL("map[2] = c", s[0]);
+      CHECK_EQUAL("map[3] = d", s[1]);
+      CHECK_EQUAL('c', map[2]);
+      CHECK_EQUAL('d', map[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_equal_different_insertion_order)
+    {
+      etl::flat_hash_map<int, int, 100> data1;
+      etl::flat_hash_map<int, int, 100> data2;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data1[i]      = i * 2;
+        data2[99 - i] = (99 - i) * 2;
+      }
+
+      CHECK(data1 == data2);
+
+      data2[50] = 0;
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST(test_fill_to_capacity_with_colliding_hashes)
+    {
+      struct constant_hash
+      {
+        size_t operator ()(int) const
+        {
+          return 0U;
+        }
+      };
+
+      etl::flat_hash_map<int, int, 20, constant_hash> data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK(data.insert(std::make_pair(i, i)).second);
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(i, data.at(i));
+      }
+
+      for (int i = 0; i < 20; i += 2)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(((i % 2) == 0) ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_long_probe_sequences)
+    {
+      struct constant_hash
+      {
+        size_t operator ()(int) const
+        {
+          return 0U;
+        }
+      };
+
+      // Every key has the same home slot and tag, so the probe distances go up to the size.
+      const size_t Size = 200;
+
+      etl::flat_hash_map<int, int, Size, constant_hash> data;
+
+      for (int i = 0; i < int(Size); ++i)
+      {
+        CHECK(data.insert(std::make_pair(i, i)).second);
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < int(Size); ++i)
+      {
+        CHECK(data.find(i) != data.end());
+      }
+
+      CHECK(data.find(int(Size)) == data.end());
+
+      for (int i = 0; i < int(Size); i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < int(Size); ++i)
+      {
+        CHECK_EQUAL(((i % 3) == 0) ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_probe_does_not_pass_the_maximum_distance)
+    {
+      typedef etl::flat_hash_map<int, int, 512, cluster_hash, counting_key_equal> Data;
+      typedef etl::private_flat_hash::table_size<512> Table_Size;
+
+      const size_t Last_Index = 255U;
+
+      // Find a hash with its home slot at the last index that a probe from slot 0
+      // could read, and the tag one above that of the keys below 1000.
+      const size_t Wanted = (Last_Index << CHAR_BIT) | 1U;
+
+      other_key_hash = 1U;
+
+      while (((other_key_hash * etl::private_flat_hash::fibonacci_multiplier<>::value) >> (Table_Size::Shift - CHAR_BIT)) != Wanted)
+      {
+        ++other_key_hash;
+      }
+
+      Data data;
+
+      // Leave an erased slot there, which keeps its tag.
+      CHECK(data.insert(std::make_pair(1000, 0)).second);
+      CHECK_EQUAL(1U, data.erase(1000));
+      dead_key          = 1000;
+      dead_key_compares = 0;
+
+      // Fill one cluster to the maximum distance.
+      for (int i = 0; i < int(Data::Max_Distance); ++i)
+      {
+        CHECK(data.insert(std::make_pair(i, i)).second);
+      }
+
+      CHECK(data.find(999) == data.end());
+      CHECK_EQUAL(0, dead_key_compares);
+
+      for (int i = 0; i < int(Data::Max_Distance); ++i)
+      {
+        CHECK(data.find(i) != data.end());
+      }
+
+      CHECK_EQUAL(0, dead_key_compares);
+      dead_key = -1;
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase_against_std_map)
+    {
+      const size_t Size = 1000;
+
+      etl::flat_hash_map<uint32_t, uint32_t, Size> data;
+      std::map<uint32_t, uint32_t> compare_data;
+
+      uint32_t seed = 1;
+
+      for (size_t i = 0UL; i < 100000UL; ++i)
+      {
+        seed = seed * 1664525U + 1013904223U;
+        uint32_t key = (seed >> 8) % 2000U;
+
+        if (((seed & 1U) == 0U) && (compare_data.size() < Size))
+        {
+          bool inserted = data.insert(std::make_pair(key, uint32_t(i))).second;
+          bool compare_inserted = compare_data.insert(std::make_pair(key, uint32_t(i))).second;
+          CHECK_EQUAL(compare_inserted, inserted);
+        }
+        else
+        {
+          CHECK_EQUAL(compare_data.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK_EQUAL(compare_data.size(), size_t(std::distance(data.begin(), data.end())));
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = compare_data.begin(); itr != compare_data.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_while_iterating)
+    {
+      etl::flat_hash_map<int, int, 100> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i;
+      }
+
+      int visited = 0;
+      etl::flat_hash_map<int, int, 100>::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        ++visited;
+
+        if ((itr->first % 3) == 0)
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(100, visited);
+      CHECK_EQUAL(66U, data.size());
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(((i % 3) == 0) ? 0U : 1U, data.count(i));
+      }
+    }
+  };
+}
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <utility>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <iostream>
@@ -804,6 +805,58 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      std::vector<ElementNDC> existing = { ElementNDC(8, N8), ElementNDC(2, N2), ElementNDC(5, N5) };
+      std::vector<ElementNDC> values   = { ElementNDC(9, N9), ElementNDC(5, N15), ElementNDC(1, N1), ElementNDC(7, N7), ElementNDC(1, N1), ElementNDC(3, N3) };
+
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(existing.begin(), existing.end());
+      data.insert(values.begin(), values.end());
+
+      // The values with keys that were already present have been destroyed.
+      CHECK_EQUAL(current_count + int(data.size()), NDC::get_instance_count());
+
+      Compare_DataNDC compare_data(existing.begin(), existing.end());
+      compare_data.insert(values.begin(), values.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_full_with_existing_keys)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::vector<ElementNDC> values(initial_data.rbegin(), initial_data.rend());
+      data.insert(values.begin(), values.end());
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique)
+    {
+      DataNDC data(etl::sorted_unique, initial_data.begin(), initial_data.begin() + 5);
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      // Merge a sorted range that overlaps the existing keys.
+      data.insert(etl::sorted_unique, initial_data.begin() + 3, initial_data.end());
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -1261,5 +1314,35 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      using Transparent = etl::flat_map<std::string, int, SIZE, etl::less<>>;
+
+      Transparent data;
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      const Transparent& cdata = data;
+
+      CHECK_EQUAL(3, data.find(std::string_view("3"))->second);
+      CHECK_EQUAL(5, cdata.find(std::string_view("5"))->second);
+      CHECK(data.end() == data.find(std::string_view("4")));
+      CHECK_EQUAL(1U, data.count(std::string_view("1")));
+      CHECK_EQUAL(0U, cdata.count(std::string_view("2")));
+      CHECK_EQUAL(3, data.lower_bound(std::string_view("2"))->second);
+      CHECK_EQUAL(3, cdata.lower_bound(std::string_view("3"))->second);
+      CHECK_EQUAL(5, data.upper_bound(std::string_view("3"))->second);
+      CHECK(cdata.end() == cdata.upper_bound(std::string_view("5")));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range(std::string_view("3"));
+      CHECK_EQUAL(3, range.first->second);
+      CHECK_EQUAL(5, range.second->second);
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range(std::string_view("4"));
+      CHECK(crange.first == crange.second);
+    }
   };
 }
@@ -565,6 +565,59 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      std::vector<NDC> existing = { N8, N2, N5 };
+      std::vector<NDC> values   = { N9, N5, N1, N7, N1, N3 };
+
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(existing.begin(), existing.end());
+      data.insert(values.begin(), values.end());
+
+      // The values that were already present have been destroyed.
+      CHECK_EQUAL(current_count + int(data.size()), NDC::get_instance_count());
+
+      Compare_DataNDC compare_data(existing.begin(), existing.end());
+      compare_data.insert(values.begin(), values.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_full_with_existing_values)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::vector<NDC> values(initial_data.rbegin(), initial_data.rend());
+      data.insert(values.begin(), values.end());
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      std::vector<NDC> sorted(compare_data.begin(), compare_data.end());
+
+      DataNDC data(etl::sorted_unique, sorted.begin(), sorted.begin() + 5);
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), sorted.begin()));
+
+      // Merge a sorted range that overlaps the existing values.
+      data.insert(etl::sorted_unique, sorted.begin() + 3, sorted.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -0,0 +1,303 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/format.h"
+#include "etl/string.h"
+#include "etl/wstring.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+#include "etl/string_view.h"
+#include "etl/to_string.h"
+
+#include <string>
+#include <iterator>
+#include <limits>
+
+#if ETL_CPP17_SUPPORTED
+
+namespace
+{
+  typedef etl::string<100> Text;
+
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_literal_text)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING(""));
+      CHECK_EQUAL(std::string(""), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("Hello World"));
+      CHECK_EQUAL(std::string("Hello World"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{{}} {{{}}} }}{{"), 1);
+      CHECK_EQUAL(std::string("{} {1} }{"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_argument_indexes)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING("{} {} {}"), 1, 2, 3);
+      CHECK_EQUAL(std::string("1 2 3"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{2} {0} {1} {0}"), 1, 2, 3);
+      CHECK_EQUAL(std::string("3 1 2 1"), std::string(text.c_str()));
+
+      // Unused arguments are allowed.
+      etl::format(text, ETL_FORMAT_STRING("{1}"), 1, 2, 3);
+      CHECK_EQUAL(std::string("2"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_format_replaces_and_format_to_appends)
+    {
+      Text text("Previous ");
+
+      etl::format_to(text, ETL_FORMAT_STRING("{}"), 1);
+      CHECK_EQUAL(std::string("Previous 1"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{}"), 2);
+      CHECK_EQUAL(std::string("2"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING("{} {} {} {}"), 0, 123, -123, 4294967295U);
+      CHECK_EQUAL(std::string("0 123 -123 4294967295"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{} {}"), std::numeric_limits<long long>::min(), std::numeric_limits<unsigned long long>::max());
+      CHECK_EQUAL(std::string("-9223372036854775808 18446744073709551615"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{} {} {} {}"), int8_t(-128), uint8_t(255), int16_t(-32768), uint16_t(65535));
+      CHECK_EQUAL(std::string("-128 255 -32768 65535"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_integer_bases)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING("{:x} {:X} {:o} {:b} {:B} {:d}"), 0xABCD, 0xABCD, 8, 5, 5, 10);
+      CHECK_EQUAL(std::string("abcd ABCD 10 101 101 10"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{:#x} {:#X} {:#o} {:#b} {:#B}"), 255, 255, 8, 5, 5);
+      CHECK_EQUAL(std::string("0xff 0XFF 010 0b101 0B101"), std::string(text.c_str()));
+
+      // Zero keeps its base prefix, except in octal.
+      etl::format(text, ETL_FORMAT_STRING("{:#x} {:#X} {:#o} {:#b} {:+#x} {:#06x} {:#x}"), 0, 0U, 0, 0, 0, 0, false);
+      CHECK_EQUAL(std::string("0x0 0X0 0 0b0 +0x0 0x0000 0x0"), std::string(text.c_str()));
+
+      // Negative values keep their sign, as std::format.
+      etl::format(text, ETL_FORMAT_STRING("{:x} {:#x} {:b}"), -255, -255, std::numeric_limits<int64_t>::min());
+      CHECK_EQUAL(std::string("-ff -0xff -1000000000000000000000000000000000000000000000000000000000000000"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_width_fill_and_alignment)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING("[{:6}] [{:<6}] [{:>6}] [{:*<6}] [{:*>6}] [{:2}]"), 42, 42, 42, 42, 42, 12345);
+      CHECK_EQUAL(std::string("[    42] [42    ] [    42] [42****] [****42] [12345]"), std::string(text.c_str()));
+
+      // Strings, characters and booleans are left aligned by default.
+      etl::format(text, ETL_FORMAT_STRING("[{:6}] [{:3}] [{:6}] [{:>6}]"), "ab", 'c', true, "ab");
+      CHECK_EQUAL(std::string("[ab    ] [c  ] [true  ] [    ab]"), std::string(text.c_str()));
+
+      // A fill of '{' or '}' is not allowed, but ':' and '0' are.
+      etl::format(text, ETL_FORMAT_STRING("[{::>4}] [{:0<4}]"), 1, 1);
+      CHECK_EQUAL(std::string("[:::1] [1000]"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_zero_padding_and_sign)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING("[{:06}] [{:06}] [{:#06x}] [{:#06x}] [{:+06}]"), 42, -42, 255, -10, 42);
+      CHECK_EQUAL(std::string("[000042] [-00042] [0x00ff] [-0x00a] [+00042]"), std::string(text.c_str()));
+
+      // An alignment turns off zero padding.
+      etl::format(text, ETL_FORMAT_STRING("[{:<06}] [{:>06}]"), 42, 42);
+      CHECK_EQUAL(std::string("[42    ] [    42]"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{:+} {:+} {: } {: } {:-}"), 1, -1, 1, -1, 1);
+      CHECK_EQUAL(std::string("+1 -1  1 -1 1"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_booleans_and_characters)
+    {
+      Text text;
+
+      etl::format(text, ETL_FORMAT_STRING("{} {} {:s} {:d} {:d}"), true, false, true, true, false);
+      CHECK_EQUAL(std::string("true false true 1 0"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{} {:c} {:d} {:#x} {:c}"), 'a', 'b', 'A', 'A', 66);
+      CHECK_EQUAL(std::string("a b 65 0x41 B"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      Text text;
+
+      // The default is the shortest representation.
+      etl::format(text, ETL_FORMAT_STRING("{} {} {} {}"), 0.1, 2.5, -1.0 / 3.0, 1e300);
+      CHECK_EQUAL(std::string("0.1 2.5 -0.3333333333333333 1e+300"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{:f} {:.2f} {:.0f} {:e} {:.3E}"), 3.14159, 3.14159, 2.7, 1234.5, 1234.56);
+      CHECK_EQUAL(std::string("3.141590 3.14 3 1.234500e+03 1.235E+03"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("[{:10.3f}] [{:<10.3f}] [{:010.3f}] [{:+.1f}]"), -3.14159, 3.14159, -3.14159, 2.26f);
+      CHECK_EQUAL(std::string("[    -3.142] [3.142     ] [-00003.142] [+2.3]"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_infinity_nan_and_negative_zero)
+    {
+      Text text;
+
+      const double inf  = std::numeric_limits<double>::infinity();
+      const float  finf = std::numeric_limits<float>::infinity();
+      const double nan  = std::numeric_limits<double>::quiet_NaN();
+
+      etl::format(text, ETL_FORMAT_STRING("{} {:f} {:e} {:g} {:F} {:E} {:G}"), -inf, -inf, -inf, -inf, -inf, -inf, -inf);
+      CHECK_EQUAL(std::string("-inf -inf -inf -inf -INF -INF -INF"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{} {:f} {:e} {:g} {:F}"), -finf, -finf, -finf, -finf, -finf);
+      CHECK_EQUAL(std::string("-inf -inf -inf -inf -INF"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{} {:+} {:F} {} {:F} {}"), inf, finf, inf, nan, nan, -nan);
+      CHECK_EQUAL(std::string("inf +inf INF nan NAN -nan"), std::string(text.c_str()));
+
+      // Infinity and NaN are not padded with zeros.
+      etl::format(text, ETL_FORMAT_STRING("[{:08}] [{:06f}] [{:<6}]"), -inf, nan, -inf);
+      CHECK_EQUAL(std::string("[    -inf] [   nan] [-inf  ]"), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{} {:f} {:.1e} {}"), -0.0, -0.0, -0.0f, 0.0);
+      CHECK_EQUAL(std::string("-0 -0.000000 -0.0e+00 0"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      Text text;
+
+      const char*      p = "pointer";
+      char             a[] = "array";
+      etl::string<10>  s("etl");
+      etl::string_view v("view");
+
+      etl::format(text, ETL_FORMAT_STRING("{} {} {} {} {:s}"), p, a, s, v, "literal");
+      CHECK_EQUAL(std::string("pointer array etl view literal"), std::string(text.c_str()));
+
+      // The precision is the maximum number of characters.
+      etl::format(text, ETL_FORMAT_STRING("[{:.3}] [{:6.3}] [{:.10}] [{:.0}]"), "abcdef", "abcdef", "abcdef", "abcdef");
+      CHECK_EQUAL(std::string("[abc] [abc   ] [abcdef] []"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_pointers)
+    {
+      Text text;
+
+      int i = 0;
+      const void* null = ETL_NULLPTR;
+
+      Text expected;
+      etl::to_string(static_cast<const volatile void*>(&i), expected, etl::format_spec().hex().show_base(true));
+
+      etl::format(text, ETL_FORMAT_STRING("{}"), &i);
+      CHECK_EQUAL(std::string(expected.c_str()), std::string(text.c_str()));
+
+      etl::format(text, ETL_FORMAT_STRING("{:p} [{:5}] [{:05}] [{:<5}]"), null, null, null, null);
+      CHECK_EQUAL(std::string("0x0 [  0x0] [0x000] [0x0  ]"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<10> text;
+
+      etl::format(text, ETL_FORMAT_STRING("{} {}"), "Hello", "World");
+      CHECK_EQUAL(std::string("Hello Worl"), std::string(text.c_str()));
+      CHECK(text.is_truncated());
+
+      etl::format(text, ETL_FORMAT_STRING("[{:>20}]"), 1);
+      CHECK_EQUAL(10U, text.size());
+      CHECK(text.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_output_iterator)
+    {
+      std::string text;
+
+      std::back_insert_iterator<std::string> end = etl::format_to(std::back_inserter(text), ETL_FORMAT_STRING("{} [{:>6}] [{:6}] [{:.2}] {:#06x} {:.1f}{{}}"), "Hello", "ab", "cd", "efgh", 255, 2.26);
+      CHECK_EQUAL(std::string("Hello [    ab] [cd    ] [ef] 0x00ff 2.3{}"), text);
+
+      *end = '!';
+      CHECK_EQUAL(std::string("Hello [    ab] [cd    ] [ef] 0x00ff 2.3{}!"), text);
+
+      char buffer[20] = {};
+      char* last = etl::format_to(buffer, ETL_FORMAT_STRING("{}-{}"), 12, 34);
+      CHECK_EQUAL(5, last - buffer);
+      CHECK_EQUAL(std::string("12-34"), std::string(buffer));
+    }
+
+    //*************************************************************************
+    TEST(test_wide_strings)
+    {
+      etl::wstring<40>   wtext;
+      etl::u16string<40> u16text;
+      etl::u32string<40> u32text;
+
+      etl::format(wtext, ETL_FORMAT_STRING(L"{} [{:*>5}] {:#x} {}"), 12, L"ab", 255, 2.5);
+      CHECK(wtext == etl::wstring<40>(L"12 [***ab] 0xff 2.5"));
+
+      etl::format(u16text, ETL_FORMAT_STRING(u"{} [{:<5}] {}"), -12, u"ab", u'c');
+      CHECK(u16text == etl::u16string<40>(u"-12 [ab   ] c"));
+
+      etl::format(u32text, ETL_FORMAT_STRING(U"{1} {0}"), U"ab", true);
+      CHECK(u32text == etl::u32string<40>(U"true ab"));
+    }
+  };
+}
+
+#endif
@@ -55,6 +55,9 @@ namespace
       CHECK_EQUAL(true,  format.is_right());
       CHECK_EQUAL(false, format.is_show_base());
       CHECK_EQUAL(false, format.is_upper_case());
+      CHECK_EQUAL(true,  format.is_fixed());
+      CHECK_EQUAL(false, format.is_scientific());
+      CHECK_EQUAL(false, format.is_general());
     }
 
     //*************************************************************************
@@ -91,6 +94,30 @@ namespace
       CHECK_EQUAL(true,  format.is_upper_case());
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_notation)
+    {
+      etl::format_spec format;
+
+      format.scientific();
+      CHECK_EQUAL(false, format.is_fixed());
+      CHECK_EQUAL(true,  format.is_scientific());
+      CHECK_EQUAL(false, format.is_general());
+      CHECK(format != etl::format_spec());
+
+      format.general();
+      CHECK_EQUAL(false, format.is_fixed());
+      CHECK_EQUAL(false, format.is_scientific());
+      CHECK_EQUAL(true,  format.is_general());
+
+      format.fixed();
+      CHECK_EQUAL(true,  format.is_fixed());
+      CHECK(format == etl::format_spec());
+
+      format.scientific().clear();
+      CHECK_EQUAL(true,  format.is_fixed());
+    }
+
     //*************************************************************************
     TEST(test_format_constexpr)
     {
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <list>
 #include <vector>
 #include <numeric>
+#include <string>
 
 namespace
 {
@@ -278,5 +279,19 @@ namespace
       CHECK_EQUAL(uint8_t(~0xAAU), f(0xAAU));
       CHECK_EQUAL(uint8_t(~0xFFU), f(0xFFU));
     }
+
+    //*************************************************************************
+    TEST(test_transparent_comparators)
+    {
+      CHECK((etl::less<>()(1, 2L)));
+      CHECK(!(etl::less<>()(2L, 1)));
+      CHECK((etl::less_equal<>()(1, 1L)));
+      CHECK((etl::greater<>()(2L, 1)));
+      CHECK((etl::greater_equal<>()(1, 1L)));
+      CHECK((etl::equal_to<>()(1, 1L)));
+      CHECK((etl::not_equal_to<>()(1, 2L)));
+      CHECK((etl::less<>()(std::string("a"), "b")));
+      CHECK((etl::equal_to<>()("a", std::string("a"))));
+    }
   };
 }
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <utility>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "etl/map.h"
@@ -1279,5 +1280,35 @@ namespace
             }
         }
     }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      using Transparent = etl::map<std::string, int, MAX_SIZE, etl::less<>>;
+
+      Transparent data;
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      const Transparent& cdata = data;
+
+      CHECK_EQUAL(3, data.find(std::string_view("3"))->second);
+      CHECK_EQUAL(5, cdata.find(std::string_view("5"))->second);
+      CHECK(data.end() == data.find(std::string_view("4")));
+      CHECK_EQUAL(1U, data.count(std::string_view("1")));
+      CHECK_EQUAL(0U, cdata.count(std::string_view("2")));
+      CHECK_EQUAL(3, data.lower_bound(std::string_view("2"))->second);
+      CHECK_EQUAL(3, cdata.lower_bound(std::string_view("3"))->second);
+      CHECK_EQUAL(5, data.upper_bound(std::string_view("3"))->second);
+      CHECK(cdata.end() == cdata.upper_bound(std::string_view("5")));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range(std::string_view("3"));
+      CHECK_EQUAL(3, range.first->second);
+      CHECK_EQUAL(5, range.second->second);
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range(std::string_view("4"));
+      CHECK(crange.first == crange.second);
+    }
   };
 }
@@ -224,6 +224,30 @@ namespace
     int message_unknown_count;
   };
 
+  //***************************************************************************
+  // RouterB that counts the calls to accepts.
+  //***************************************************************************
+  class RouterC : public RouterB
+  {
+  public:
+
+    RouterC(etl::message_router_id_t id)
+      : RouterB(id),
+        accepts_count(0)
+    {
+    }
+
+    using RouterB::accepts;
+
+    bool accepts(etl::message_id_t id) const override
+    {
+      ++accepts_count;
+      return RouterB::accepts(id);
+    }
+
+    mutable int accepts_count;
+  };
+
   SUITE(test_message_router)
   {
     //*************************************************************************
@@ -883,5 +907,159 @@ namespace
 
       CHECK_EQUAL(6, callback.message5_count);
     }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast)
+    {
+      etl::message_bus<3, 8> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterC router2(ROUTER2);
+      RouterC router3(ROUTER3);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+
+      bus1.receive(message1);
+      bus1.receive(message1);
+      bus1.receive(message3);
+      bus1.receive(message3);
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(2, router1.message3_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      // Each id was only checked once.
+      CHECK_EQUAL(2, router2.accepts_count);
+
+      // The index is rebuilt when the subscribers change.
+      bus1.subscribe(router3);
+      bus1.receive(message1);
+
+      CHECK_EQUAL(3, router1.message1_count);
+      CHECK_EQUAL(3, router2.message1_count);
+      CHECK_EQUAL(1, router3.message1_count);
+      CHECK_EQUAL(3, router2.accepts_count);
+
+      bus1.unsubscribe(router2);
+      bus1.receive(message1);
+
+      CHECK_EQUAL(4, router1.message1_count);
+      CHECK_EQUAL(3, router2.message1_count);
+      CHECK_EQUAL(2, router3.message1_count);
+
+      bus1.unsubscribe(ROUTER3);
+      bus1.receive(message1);
+
+      CHECK_EQUAL(5, router1.message1_count);
+      CHECK_EQUAL(2, router3.message1_count);
+
+      bus1.clear();
+      bus1.receive(message1);
+
+      CHECK_EQUAL(5, router1.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_order)
+    {
+      etl::message_bus<4, 4> bus1;
+      etl::message_bus<2, 4> bus2;
+      etl::message_bus<2, 4> bus3;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4a(ROUTER4);
+      RouterA router4b(ROUTER4);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus3);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2);
+
+      bus2.subscribe(router3);
+      bus3.subscribe(router4b);
+      bus3.subscribe(router4a);
+
+      Message1 message1(callback);
+
+      call_order = 0;
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router2.order);
+      CHECK_EQUAL(2, router4b.order);
+      CHECK_EQUAL(3, router4a.order);
+      CHECK_EQUAL(4, router3.order);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_index_full)
+    {
+      etl::message_bus<2, 1> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterC router2(ROUTER2);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+
+      bus1.receive(message1);
+      bus1.receive(message3);
+      bus1.receive(message3);
+      bus1.receive(message1);
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(2, router1.message3_count);
+      CHECK_EQUAL(2, router2.message1_count);
+
+      // Message 1 is indexed. Message 3 is checked every time.
+      CHECK_EQUAL(3, router2.accepts_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_broadcast_batch)
+    {
+      etl::message_bus<2, 4> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      Message1 message1(callback);
+      Message2 message2(callback);
+      Message3 message3(callback);
+
+      const etl::imessage* messages[] = { &message1, &message3, &message2, &message1 };
+
+      bus1.receive(etl::span<const etl::imessage* const>(messages, 4U));
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router2.message2_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(7, callback.message5_count);
+    }
   };
 }
@@ -0,0 +1,385 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "etl/message_mailbox.h"
+#include "etl/message_bus.h"
+#include "etl/message_router.h"
+#include "etl/shared_message.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/scheduler.h"
+#include "etl/scheduler_event_driven.h"
+#include "etl/function.h"
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+  constexpr etl::message_id_t MessageId3 = 3U;
+
+  constexpr etl::message_router_id_t RouterId1 = 1U;
+  constexpr etl::message_router_id_t RouterId2 = 2U;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>
+  {
+  };
+
+  //*************************************************************************
+  struct Message3 : public etl::message<MessageId3>
+  {
+  };
+
+  //*************************************************************************
+  struct Router1 : public etl::message_router<Router1, Message1, Message2>
+  {
+    Router1(etl::message_router_id_t id)
+      : message_router(id)
+      , count_message1(0)
+      , count_message2(0)
+      , sum(0)
+      , in_order(true)
+    {
+    }
+
+    void on_receive(const Message1& message)
+    {
+      in_order = in_order && (message.i == count_message1);
+      ++count_message1;
+      sum += message.i;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++count_message2;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int  count_message1;
+    int  count_message2;
+    long sum;
+    bool in_order;
+  };
+
+  //*************************************************************************
+  // A pool that may be used from more than one thread.
+  //*************************************************************************
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2, Message3>;
+
+  //*************************************************************************
+  // Counts the blocks that are in use.
+  //*************************************************************************
+  template <size_t SIZE>
+  class allocator_t : public etl::imemory_block_allocator
+  {
+  public:
+
+    allocator_t()
+      : in_use(0)
+    {
+    }
+
+    size_t available() const
+    {
+      return SIZE - size_t(in_use.load());
+    }
+
+  private:
+
+    void* allocate_block(size_t required_size, size_t required_alignment) override
+    {
+      void* p = allocator.allocate(required_size, required_alignment);
+
+      if (p != nullptr)
+      {
+        ++in_use;
+      }
+
+      return p;
+    }
+
+    bool release_block(const void* const pblock) override
+    {
+      --in_use;
+      return allocator.release(pblock);
+    }
+
+    etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size, pool_message_parameters::max_alignment, SIZE> allocator;
+    std::atomic<int> in_use;
+  };
+
+  class LockedPool : public etl::atomic_counted_message_pool
+  {
+  public:
+
+    LockedPool(etl::imemory_block_allocator& allocator)
+      : etl::atomic_counted_message_pool(allocator)
+    {
+    }
+
+  protected:
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+  private:
+
+    std::mutex mutex;
+  };
+
+  SUITE(test_message_mailbox)
+  {
+    //*************************************************************************
+    TEST(test_queued_until_processed)
+    {
+      allocator_t<16U> allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router1 router1(RouterId1);
+      Router1 router2(RouterId2);
+
+      etl::message_mailbox<4U> mailbox1(router1);
+      etl::message_mailbox<4U> mailbox2(router2);
+
+      CHECK_EQUAL(RouterId1, mailbox1.get_message_router_id());
+      CHECK(mailbox1.accepts(MessageId1));
+      CHECK(!mailbox1.accepts(MessageId3));
+
+      etl::message_bus<2U> bus;
+      bus.subscribe(mailbox1);
+      bus.subscribe(mailbox2);
+
+      {
+        etl::shared_message sm0(pool, Message1(0));
+        etl::shared_message sm1(pool, Message1(1));
+        etl::shared_message sm2(pool, Message2());
+        etl::shared_message sm3(pool, Message3());
+
+        bus.receive(sm0);
+        bus.receive(sm1);
+        bus.receive(sm2);
+        bus.receive(sm3);            // Not accepted.
+        bus.receive(RouterId2, sm0); // Addressed to router 2.
+
+        // Not copied. One reference for each mailbox.
+        CHECK_EQUAL(4, sm0.get_reference_count());
+        CHECK_EQUAL(3, sm1.get_reference_count());
+        CHECK_EQUAL(3, sm2.get_reference_count());
+        CHECK_EQUAL(1, sm3.get_reference_count());
+      }
+
+      // Nothing has been delivered yet.
+      CHECK_EQUAL(0, router1.count_message1);
+      CHECK_EQUAL(3U, mailbox1.size());
+      CHECK_EQUAL(4U, mailbox2.size());
+      CHECK_EQUAL(4U, mailbox2.task_request_work());
+
+      CHECK_EQUAL(2U, mailbox1.process(2U));
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(0, router1.count_message2);
+
+      CHECK_EQUAL(1U, mailbox1.process());
+      CHECK_EQUAL(4U, mailbox2.process());
+
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(1, router1.count_message2);
+      CHECK_EQUAL(3, router2.count_message1);
+      CHECK_EQUAL(1, router2.count_message2);
+      CHECK(mailbox1.empty());
+
+      // All of the messages have been returned to the pool.
+      CHECK_EQUAL(16U, allocator.available());
+    }
+
+    //*************************************************************************
+    TEST(test_plain_message_is_an_error)
+    {
+      Router1 router1(RouterId1);
+      etl::message_mailbox<4U> mailbox1(router1);
+
+      CHECK_THROW(mailbox1.receive(Message1(0)), etl::message_mailbox_not_shared);
+    }
+
+    //*************************************************************************
+    TEST(test_full_policies)
+    {
+      allocator_t<16U> allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router1 router1(RouterId1);
+      Router1 router2(RouterId2);
+
+      etl::message_mailbox<2U> drop_newest(router1, etl::message_mailbox_policy::Drop_Newest);
+      etl::message_mailbox<2U> drop_oldest(router2, etl::message_mailbox_policy::Drop_Oldest);
+
+      for (int i = 0; i < 5; ++i)
+      {
+        etl::shared_message sm(pool, Message1(i));
+        drop_newest.receive(sm);
+        drop_oldest.receive(sm);
+      }
+
+      CHECK_EQUAL(3U, drop_newest.dropped_count());
+      CHECK_EQUAL(3U, drop_oldest.dropped_count());
+
+      drop_newest.process();
+      drop_oldest.process();
+
+      // Kept the first two.
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(1, router1.sum);
+
+      // Kept the last two.
+      CHECK_EQUAL(2, router2.count_message1);
+      CHECK_EQUAL(7, router2.sum);
+
+      CHECK_EQUAL(16U, allocator.available());
+    }
+
+    //*************************************************************************
+    TEST(test_mailbox_as_a_scheduler_task)
+    {
+      allocator_t<8U> allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router1 router1(RouterId1);
+      etl::message_mailbox<8U> mailbox1(router1, etl::message_mailbox_policy::Drop_Newest, 1U);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        mailbox1.receive(etl::shared_message(pool, Message1(i)));
+      }
+
+      struct Exit
+      {
+        void OnIdle()
+        {
+          p_scheduler->exit_scheduler();
+        }
+
+        etl::ischeduler* p_scheduler;
+      };
+
+      etl::scheduler_event_driven<1U> scheduler;
+
+      Exit exit = { &scheduler };
+      etl::function<Exit, void> idle_callback(exit, &Exit::OnIdle);
+
+      scheduler.set_idle_callback(idle_callback);
+      scheduler.add_task(mailbox1);
+      scheduler.start();
+
+      CHECK_EQUAL(4, router1.count_message1);
+      CHECK(router1.in_order);
+      CHECK(mailbox1.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_publishers_and_worker_thread)
+    {
+      static const int Messages = 20000;
+
+      allocator_t<64U> allocator;
+      LockedPool pool(allocator);
+
+      Router1 router1(RouterId1);
+      Router1 router2(RouterId2);
+
+      etl::message_mailbox<16U> mailbox1(router1, etl::message_mailbox_policy::Wait);
+      etl::message_mailbox<16U> mailbox2(router2, etl::message_mailbox_policy::Wait);
+
+      etl::message_bus<2U> bus;
+      bus.subscribe(mailbox1);
+      bus.subscribe(mailbox2);
+
+      std::atomic<bool> publishing(true);
+
+      // Drains both mailboxes.
+      std::thread worker([&]()
+      {
+        while (publishing.load() || !mailbox1.empty() || !mailbox2.empty())
+        {
+          if ((mailbox1.process() + mailbox2.process()) == 0U)
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      for (int i = 0; i < Messages; ++i)
+      {
+        // Wait for the pool to have room.
+        while (allocator.available() == 0U)
+        {
+          std::this_thread::yield();
+        }
+
+        etl::shared_message sm(pool, Message1(i));
+        bus.receive(sm);
+      }
+
+      publishing = false;
+      worker.join();
+
+      CHECK_EQUAL(Messages, router1.count_message1);
+      CHECK_EQUAL(Messages, router2.count_message1);
+      CHECK(router1.in_order);
+      CHECK(router2.in_order);
+      CHECK_EQUAL(0U, mailbox1.dropped_count());
+      CHECK_EQUAL(64U, allocator.available());
+    }
+  };
+}
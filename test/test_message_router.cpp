@@ -32,6 +32,8 @@ SOFTWARE.
 #include "etl/queue.h"
 #include "etl/largest.h"
 
+#include <utility>
+
 //***************************************************************************
 // The set of messages.
 //***************************************************************************
@@ -266,6 +268,79 @@ namespace
 
   etl::imessage_router* p_router;
 
+#if ETL_CPP17_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***********************************
+  // Routers with many message types and with sparse message ids.
+  //***********************************
+  template <etl::message_id_t ID>
+  struct Numbered : public etl::message<ID>
+  {
+  };
+
+  template <typename TDerived, typename... TMessageTypes>
+  class Counting_Router : public etl::message_router<TDerived, TMessageTypes...>
+  {
+  public:
+
+    Counting_Router()
+      : etl::message_router<TDerived, TMessageTypes...>(ROUTER3)
+      , last_id(0)
+      , message_count(0)
+      , message_unknown_count(0)
+    {
+    }
+
+    template <typename TMessage>
+    void on_receive(const TMessage& msg)
+    {
+      last_id = msg.get_message_id();
+      ++message_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int last_id;
+    int message_count;
+    int message_unknown_count;
+  };
+
+  // 40 message types with every third id.
+  template <size_t... Indexes>
+  class Wide_Router : public Counting_Router<Wide_Router<Indexes...>, Numbered<etl::message_id_t(Indexes * 3U)>...>
+  {
+  };
+
+  template <size_t... Indexes>
+  Wide_Router<Indexes...> make_wide_router(std::index_sequence<Indexes...>);
+
+  typedef decltype(make_wide_router(std::make_index_sequence<40>())) Wide_Router_40;
+
+  // Ids that are too far apart for a table.
+  class Sparse_Router : public Counting_Router<Sparse_Router, Numbered<250>, Numbered<1>, Numbered<100>, Numbered<1>>
+  {
+  };
+
+  //***********************************
+  template <size_t... Indexes>
+  void check_wide_router(std::index_sequence<Indexes...>)
+  {
+    Wide_Router_40 router;
+
+    ((router.receive(static_cast<const etl::imessage&>(Numbered<etl::message_id_t(Indexes * 3U)>())),
+      CHECK_EQUAL(int(Indexes * 3U), router.last_id)), ...);
+
+    CHECK_EQUAL(int(sizeof...(Indexes)), router.message_count);
+    CHECK_EQUAL(0, router.message_unknown_count);
+
+    router.receive(static_cast<const etl::imessage&>(Numbered<1>()));
+    router.receive(static_cast<const etl::imessage&>(Numbered<120>()));
+    CHECK_EQUAL(2, router.message_unknown_count);
+  }
+#endif
+
   SUITE(test_message_router)
   {
     //*************************************************************************
@@ -650,5 +725,47 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+#if ETL_CPP17_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+    //*************************************************************************
+    TEST(message_router_many_message_types)
+    {
+      check_wide_router(std::make_index_sequence<40>());
+
+      Wide_Router_40 router;
+
+      for (int id = 0; id < 256; ++id)
+      {
+        CHECK_EQUAL(((id % 3) == 0) && (id < 120), router.accepts(etl::message_id_t(id)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(message_router_sparse_message_ids)
+    {
+      Sparse_Router router;
+
+      router.receive(static_cast<const etl::imessage&>(Numbered<250>()));
+      CHECK_EQUAL(250, router.last_id);
+
+      router.receive(static_cast<const etl::imessage&>(Numbered<1>()));
+      CHECK_EQUAL(1, router.last_id);
+
+      router.receive(static_cast<const etl::imessage&>(Numbered<100>()));
+      CHECK_EQUAL(100, router.last_id);
+
+      CHECK_EQUAL(3, router.message_count);
+
+      router.receive(static_cast<const etl::imessage&>(Numbered<101>()));
+      router.receive(static_cast<const etl::imessage&>(Numbered<0>()));
+      router.receive(static_cast<const etl::imessage&>(Numbered<255>()));
+      CHECK_EQUAL(3, router.message_unknown_count);
+
+      for (int id = 0; id < 256; ++id)
+      {
+        CHECK_EQUAL((id == 1) || (id == 100) || (id == 250), router.accepts(etl::message_id_t(id)));
+      }
+    }
+#endif
   };
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "murmurhash3.h" // The 'C' reference implementation.
 
 #include <iterator>
+#include <list>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -39,6 +40,19 @@ SOFTWARE.
 
 namespace
 {
+  //*************************************************************************
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 167U) + 13U);
+    }
+
+    return data;
+  }
+
   SUITE(test_murmur3)
   {
     //*************************************************************************
@@ -110,6 +124,133 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_block_lengths_and_alignments)
+    {
+      std::vector<uint8_t> data = make_data(100U);
+
+      for (size_t offset = 0UL; offset < 4UL; ++offset)
+      {
+        for (size_t length = 0UL; length < (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+          const uint8_t* end   = begin + length;
+
+          uint32_t compare;
+          MurmurHash3_x86_32(begin, int(length), 0x1234U, &compare);
+
+          // Contiguous.
+          CHECK_EQUAL(compare, etl::murmur3<uint32_t>(begin, end, 0x1234U).value());
+
+          // Not contiguous.
+          std::list<uint8_t> list(begin, end);
+          CHECK_EQUAL(compare, etl::murmur3<uint32_t>(list.begin(), list.end(), 0x1234U).value());
+
+          // A partial block, then a contiguous range.
+          etl::murmur3<uint32_t> murmur3_32_calculator(0x1234U);
+          const uint8_t* split = begin + (length / 3U);
+          murmur3_32_calculator.add(begin, split);
+          murmur3_32_calculator.add(split, end);
+          CHECK_EQUAL(compare, murmur3_32_calculator.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_high_bit_chars)
+    {
+      std::string data("\x80\xFF\x7F\xC3\xA9 caf\xC3\xA9");
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.c_str(), int(data.size()), 0, &compare);
+
+      CHECK_EQUAL(compare, etl::murmur3<uint32_t>(data.begin(), data.end()).value());
+
+      etl::murmur3<uint32_t> murmur3_32_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        murmur3_32_calculator.add(data[i]);
+      }
+
+      CHECK_EQUAL(compare, murmur3_32_calculator.value());
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_constructor)
+    {
+      std::string data("123456789");
+
+      etl::murmur3_x64_128::value_type hash = etl::murmur3_x64_128(data.begin(), data.end());
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.c_str(), int(data.size()), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_add_values)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      etl::murmur3_x64_128 murmur3_128_calculator(42U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        murmur3_128_calculator.add(data[i]);
+      }
+
+      etl::murmur3_x64_128::value_type hash = murmur3_128_calculator.value();
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.c_str(), int(data.size()), 42U, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_block_lengths_and_alignments)
+    {
+      std::vector<uint8_t> data = make_data(200U);
+
+      for (size_t offset = 0UL; offset < 8UL; ++offset)
+      {
+        for (size_t length = 0UL; length < (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+          const uint8_t* end   = begin + length;
+
+          uint64_t compare[2];
+          MurmurHash3_x64_128(begin, int(length), 0x5678U, compare);
+
+          // Contiguous.
+          etl::murmur3_x64_128::value_type hash1 = etl::murmur3_x64_128(begin, end, 0x5678U).value();
+          CHECK_EQUAL(compare[0], hash1[0]);
+          CHECK_EQUAL(compare[1], hash1[1]);
+
+          // Not contiguous.
+          std::list<uint8_t> list(begin, end);
+          etl::murmur3_x64_128::value_type hash2 = etl::murmur3_x64_128(list.begin(), list.end(), 0x5678U).value();
+          CHECK_EQUAL(compare[0], hash2[0]);
+          CHECK_EQUAL(compare[1], hash2[1]);
+
+          // A partial block, then a contiguous range.
+          etl::murmur3_x64_128 murmur3_128_calculator(0x5678U);
+          const uint8_t* split = begin + (length / 3U);
+          murmur3_128_calculator.add(begin, split);
+          murmur3_128_calculator.add(split, end);
+          etl::murmur3_x64_128::value_type hash3 = murmur3_128_calculator.value();
+          CHECK_EQUAL(compare[0], hash3[0]);
+          CHECK_EQUAL(compare[1], hash3[1]);
+        }
+      }
+    }
+#endif
   };
 }
 
@@ -31,6 +31,8 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <iterator>
+#include <sstream>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -391,6 +393,154 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      const int input[] = { 1, 2, 3, 4, 5, 6 };
+      int output[6]     = { 0, 0, 0, 0, 0, 0 };
+
+      // Only as many as there is space for.
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(input + 4, input + 6));
+
+      // Only as many as were asked for.
+      CHECK_EQUAL(3U, queue.pop(output, 3));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(1U, queue.size());
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, input + 6));
+      CHECK_EQUAL(3U, queue.size());
+
+      // Only as many as there are.
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK(queue.empty());
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+      CHECK_EQUAL(0U, queue.push(input, input));
+    }
+
+    //*************************************************************************
+    TEST(test_push_range_input_iterators)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      std::istringstream input("1 2 3 4 5 6");
+      int output[4] = { 0, 0, 0, 0 };
+
+      // The length is unknown, but the queue is still filled.
+      CHECK_EQUAL(4U, queue.push(std::istream_iterator<int>(input), std::istream_iterator<int>()));
+      CHECK(queue.full());
+
+      CHECK_EQUAL(4U, queue.pop(output, 4));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(4, output[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_range_mixed_with_single)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      std::vector<int> output;
+      int next  = 0;
+      int value = 0;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        const int input[] = { next, next + 1, next + 2 };
+        next += int(queue.push(input, input + 3));
+
+        if (queue.push(next))
+        {
+          ++next;
+        }
+
+        if (queue.pop(value))
+        {
+          output.push_back(value);
+        }
+
+        queue.pop(std::back_inserter(output), 2);
+      }
+
+      while (queue.pop(value))
+      {
+        output.push_back(value);
+      }
+
+      CHECK_EQUAL(size_t(next), output.size());
+
+      for (size_t i = 0UL; i < output.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), output[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_range_threads)
+    {
+      static const int Items = 200000;
+
+      etl::queue_spsc_atomic<int, 64> queue;
+
+      std::thread producer([&queue]()
+      {
+        int buffer[16];
+        int next = 0;
+
+        while (next < Items)
+        {
+          const int n = ((Items - next) < 16) ? (Items - next) : 16;
+
+          for (int i = 0; i < n; ++i)
+          {
+            buffer[i] = next + i;
+          }
+
+          int pushed = 0;
+
+          while (pushed < n)
+          {
+            pushed += int(queue.push(buffer + pushed, buffer + n));
+          }
+
+          next += n;
+        }
+      });
+
+      int  buffer[16];
+      int  expected = 0;
+      bool in_order = true;
+
+      while (expected < Items)
+      {
+        const int n = int(queue.pop(buffer, 16));
+
+        for (int i = 0; i < n; ++i)
+        {
+          in_order = in_order && (buffer[i] == expected);
+          ++expected;
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
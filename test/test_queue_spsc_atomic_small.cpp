@@ -409,6 +409,42 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_range)
+    {
+      QueueInt queue;
+
+      const int input[] = { 1, 2, 3, 4, 5, 6 };
+      int output[6]     = { 0, 0, 0, 0, 0, 0 };
+
+      // Only as many as there is space for.
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(input + 4, input + 6));
+
+      // Only as many as were asked for.
+      CHECK_EQUAL(3U, queue.pop(output, 3));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(1U, queue.size());
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, input + 6));
+      CHECK_EQUAL(3U, queue.size());
+
+      // Only as many as there are.
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK(queue.empty());
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+      CHECK_EQUAL(0U, queue.push(input, input));
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -343,6 +343,43 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      std::vector<NDC> existing = { N8, N2, N5 };
+      std::vector<NDC> values   = { N9, N5, N1, N7, N1, N3 };
+
+      DataNDC data(existing.begin(), existing.end());
+      data.insert(values.begin(), values.end());
+
+      Compare_DataNDC compare_data(existing.begin(), existing.end());
+      compare_data.insert(values.begin(), values.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      // The existing element is still the one referenced.
+      CHECK(&*data.find(N5) == &existing[2]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      std::vector<NDC> sorted(compare_data.begin(), compare_data.end());
+
+      DataNDC data(etl::sorted_unique, sorted.begin(), sorted.begin() + 5);
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), sorted.begin()));
+
+      // Merge a sorted range that overlaps the existing values.
+      data.insert(etl::sorted_unique, sorted.begin() + 3, sorted.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
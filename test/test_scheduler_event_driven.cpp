@@ -0,0 +1,307 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+
+#include "etl/task.h"
+#include "etl/scheduler_event_driven.h"
+#include "etl/function.h"
+
+namespace
+{
+  typedef std::vector<std::string> WorkList_t;
+
+  //***************************************************************************
+  struct Common
+  {
+    Common()
+      : idle_callback(*this, &Common::IdleCallback),
+        watchdog_callback(*this, &Common::WatchdogCallback),
+        pScheduler(nullptr),
+        watchdog_called(false)
+    {
+    }
+
+    void IdleCallback()
+    {
+      pScheduler->exit_scheduler();
+    }
+
+    void WatchdogCallback()
+    {
+      watchdog_called = true;
+    }
+
+    WorkList_t workList;
+    etl::function<Common, void> idle_callback;
+    etl::function<Common, void> watchdog_callback;
+    etl::ischeduler* pScheduler;
+    bool watchdog_called;
+  };
+
+  //***************************************************************************
+  class ListTask : public etl::task
+  {
+  public:
+
+    ListTask(etl::task_priority_t priority_, const WorkList_t& work_, Common& common_)
+      : task(priority_)
+      , work(work_)
+      , common(common_)
+      , workIndex(0U)
+      , addAtIndex(0U)
+      , pTaskToAddTo(nullptr)
+      , requests(0U)
+    {
+    }
+
+    void WorkToAdd(size_t addAtIndex_, const std::string& workToAdd_, ListTask& taskToAddTo_)
+    {
+      addAtIndex   = addAtIndex_;
+      workToAdd    = workToAdd_;
+      pTaskToAddTo = &taskToAddTo_;
+    }
+
+    uint32_t task_request_work() const override
+    {
+      ++requests;
+      return uint32_t(work.size() - workIndex);
+    }
+
+    void task_process_work() override
+    {
+      common.workList.push_back(work[workIndex]);
+      ++workIndex;
+
+      if ((pTaskToAddTo != nullptr) && (workIndex == addAtIndex))
+      {
+        pTaskToAddTo->work.push_back(workToAdd);
+        pTaskToAddTo->task_set_ready();
+      }
+    }
+
+    WorkList_t  work;
+    Common&     common;
+    size_t      workIndex;
+    size_t      addAtIndex;
+    std::string workToAdd;
+    ListTask*   pTaskToAddTo;
+
+    mutable size_t requests;
+  };
+
+  //***************************************************************************
+  /// Has work posted to it from another thread.
+  //***************************************************************************
+  class PostedTask : public etl::task
+  {
+  public:
+
+    PostedTask(etl::task_priority_t priority_)
+      : task(priority_)
+      , work(0U)
+      , done(0U)
+    {
+    }
+
+    void Post()
+    {
+      work.fetch_add(1U, std::memory_order_release);
+      task_set_ready();
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return work.load(std::memory_order_acquire);
+    }
+
+    void task_process_work() override
+    {
+      ++done;
+      work.fetch_sub(1U, std::memory_order_release);
+    }
+
+    std::atomic<uint32_t> work;
+    uint32_t done;
+  };
+
+  SUITE(test_scheduler_event_driven)
+  {
+    //*************************************************************************
+    TEST(test_scheduler_highest_priority_ready)
+    {
+      Common common;
+
+      ListTask task1(1, { "T1W1", "T1W2", "T1W3" }, common);
+      ListTask task2(2, { "T2W1", "T2W2", "T2W3", "T2W4" }, common);
+      ListTask task3(3, { "T3W1", "T3W2" }, common);
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      etl::task* taskList[] = { &task1, &task2, &task3 };
+
+      etl::scheduler_event_driven<3> s;
+
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, 3);
+      s.start(); // If 'start' returns then the idle callback was sucessfully called.
+
+      // The same as scheduler_policy_highest_priority.
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //*************************************************************************
+    TEST(test_idle_tasks_are_not_asked_for_work)
+    {
+      Common common;
+
+      std::vector<ListTask*> tasks;
+
+      // 40 tasks, so that more than one word of the bitmap is used.
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        tasks.push_back(new ListTask(etl::task_priority_t(i), {}, common));
+      }
+
+      // The lowest priority task has lots of work.
+      WorkList_t busy_work(1000U, "W");
+      ListTask busy(0, busy_work, common);
+
+      etl::scheduler_event_driven<41> s;
+
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task_list(reinterpret_cast<etl::task**>(tasks.data()), tasks.size());
+      s.add_task(busy);
+      s.start();
+
+      CHECK_EQUAL(1000U, common.workList.size());
+      CHECK(!s.has_ready_tasks());
+
+      // Each idle task was asked once, when the scheduler started.
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        CHECK_EQUAL(1U, tasks[i]->requests);
+        delete tasks[i];
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_work_posted_from_another_thread)
+    {
+      static const uint32_t Posts = 100000U;
+
+      PostedTask task1(1);
+      PostedTask task2(2);
+
+      etl::task* taskList[] = { &task1, &task2 };
+
+      etl::scheduler_event_driven<2> s;
+
+      std::atomic<bool> started(false);
+      std::atomic<bool> posting_done(false);
+
+      struct Idle
+      {
+        void IdleCallback()
+        {
+          // Sleep until there is more work.
+          if (posting_done.load() && !scheduler.has_ready_tasks())
+          {
+            scheduler.exit_scheduler();
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        std::atomic<bool>&              posting_done;
+        etl::scheduler_event_driven<2>& scheduler;
+      };
+
+      struct Watchdog
+      {
+        void WatchdogCallback()
+        {
+          started = true;
+        }
+
+        std::atomic<bool>& started;
+      };
+
+      Idle idle = { posting_done, s };
+      etl::function<Idle, void> idle_callback(idle, &Idle::IdleCallback);
+
+      Watchdog watchdog = { started };
+      etl::function<Watchdog, void> watchdog_callback(watchdog, &Watchdog::WatchdogCallback);
+
+      s.set_idle_callback(idle_callback);
+      s.set_watchdog_callback(watchdog_callback);
+      s.add_task_list(taskList, 2);
+
+      std::thread poster([&]()
+      {
+        // Tasks may only be signalled from other threads once the scheduler has started.
+        while (!started)
+        {
+          std::this_thread::yield();
+        }
+
+        for (uint32_t i = 0U; i < Posts; ++i)
+        {
+          ((i & 1U) ? task1 : task2).Post();
+        }
+
+        posting_done = true;
+      });
+
+      s.start();
+      poster.join();
+
+      CHECK_EQUAL(Posts / 2U, task1.done);
+      CHECK_EQUAL(Posts / 2U, task2.done);
+      CHECK_EQUAL(0U, task1.task_request_work());
+      CHECK_EQUAL(0U, task2.task_request_work());
+    }
+  };
+}
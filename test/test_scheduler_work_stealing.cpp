@@ -0,0 +1,278 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <atomic>
+
+#include "etl/task.h"
+#include "etl/scheduler_work_stealing.h"
+#include "etl/function.h"
+
+namespace
+{
+  typedef std::vector<std::string> WorkList_t;
+
+  //***************************************************************************
+  struct Common
+  {
+    Common()
+      : idle_callback(*this, &Common::IdleCallback),
+        watchdog_callback(*this, &Common::WatchdogCallback),
+        pScheduler(nullptr),
+        watchdog_called(false)
+    {
+    }
+
+    void IdleCallback()
+    {
+      pScheduler->exit_scheduler();
+    }
+
+    void WatchdogCallback()
+    {
+      watchdog_called = true;
+    }
+
+    WorkList_t workList;
+    etl::function<Common, void> idle_callback;
+    etl::function<Common, void> watchdog_callback;
+    etl::ischeduler* pScheduler;
+    bool watchdog_called;
+  };
+
+  //***************************************************************************
+  /// Records its work in a shared list. Only for use with a single worker.
+  //***************************************************************************
+  class ListTask : public etl::task
+  {
+  public:
+
+    ListTask(etl::task_priority_t priority_, const WorkList_t& work_, Common& common_)
+      : task(priority_)
+      , work(work_)
+      , common(common_)
+      , workIndex(0U)
+      , addAtIndex(0U)
+      , pTaskToAddTo(nullptr)
+    {
+    }
+
+    void WorkToAdd(size_t addAtIndex_, const std::string& workToAdd_, ListTask& taskToAddTo_)
+    {
+      addAtIndex   = addAtIndex_;
+      workToAdd    = workToAdd_;
+      pTaskToAddTo = &taskToAddTo_;
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return uint32_t(work.size() - workIndex);
+    }
+
+    void task_process_work() override
+    {
+      common.workList.push_back(work[workIndex]);
+      ++workIndex;
+
+      if ((pTaskToAddTo != nullptr) && (workIndex == addAtIndex))
+      {
+        pTaskToAddTo->work.push_back(workToAdd);
+      }
+    }
+
+  private:
+
+    WorkList_t  work;
+    Common&     common;
+    size_t      workIndex;
+    size_t      addAtIndex;
+    std::string workToAdd;
+    ListTask*   pTaskToAddTo;
+  };
+
+  //***************************************************************************
+  /// Counts down a number of work items, checking that it is never run on two
+  /// threads at once. Optionally passes work on to another task.
+  //***************************************************************************
+  class CountingTask : public etl::task
+  {
+  public:
+
+    CountingTask(etl::task_priority_t priority_, uint32_t work_)
+      : task(priority_)
+      , work(work_)
+      , done(0U)
+      , inside(0)
+      , overlapped(false)
+      , pNext(nullptr)
+    {
+    }
+
+    void SetNext(CountingTask& next)
+    {
+      pNext = &next;
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return work.load(std::memory_order_acquire);
+    }
+
+    void task_process_work() override
+    {
+      if (inside.fetch_add(1) != 0)
+      {
+        overlapped = true;
+      }
+
+      // Some work to give the other workers time to steal.
+      volatile uint32_t spin = 0U;
+      for (int i = 0; i < 100; ++i)
+      {
+        spin = spin + 1U;
+      }
+
+      ++done;
+      work.fetch_sub(1U, std::memory_order_release);
+
+      if (pNext != nullptr)
+      {
+        pNext->work.fetch_add(1U, std::memory_order_release);
+      }
+
+      inside.fetch_sub(1);
+    }
+
+    std::atomic<uint32_t> work;
+    uint32_t done;
+    std::atomic<int> inside;
+    bool overlapped;
+    CountingTask* pNext;
+  };
+
+  SUITE(test_scheduler_work_stealing)
+  {
+    //*************************************************************************
+    TEST(test_single_worker_runs_in_priority_order)
+    {
+      Common common;
+
+      ListTask task1(1, { "T1W1", "T1W2", "T1W3" }, common);
+      ListTask task2(2, { "T2W1", "T2W2", "T2W3", "T2W4" }, common);
+      ListTask task3(3, { "T3W1", "T3W2" }, common);
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      etl::task* taskList[] = { &task1, &task2, &task3 };
+
+      etl::scheduler_work_stealing<3, 1> s;
+
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, 3);
+      s.start(); // If 'start' returns then the idle callback was sucessfully called.
+
+      // The same as scheduler_policy_sequential_single.
+      WorkList_t expected = { "T3W1", "T2W1", "T1W1", "T3W2", "T2W2", "T1W2", "T3W3", "T2W3", "T1W3", "T2W4" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_workers_do_all_of_the_work)
+    {
+      static const size_t   N_Tasks = 12U;
+      static const uint32_t Work    = 2000U;
+
+      Common common;
+
+      std::vector<CountingTask*> tasks;
+
+      for (size_t i = 0U; i < N_Tasks; ++i)
+      {
+        tasks.push_back(new CountingTask(etl::task_priority_t(i), Work));
+      }
+
+      // Each task passes work on to the next.
+      for (size_t i = 0U; i < (N_Tasks - 1U); ++i)
+      {
+        tasks[i]->SetNext(*tasks[i + 1U]);
+      }
+
+      etl::scheduler_work_stealing<N_Tasks, 4> s;
+
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(reinterpret_cast<etl::task**>(tasks.data()), tasks.size());
+      s.start();
+
+      CHECK(common.watchdog_called);
+
+      for (size_t i = 0U; i < N_Tasks; ++i)
+      {
+        CHECK_EQUAL(0U, tasks[i]->task_request_work());
+        CHECK_EQUAL(Work * (i + 1U), tasks[i]->done);
+        CHECK(!tasks[i]->overlapped);
+
+        delete tasks[i];
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_more_workers_than_tasks)
+    {
+      Common common;
+
+      CountingTask task1(1, 100U);
+      CountingTask task2(2, 100U);
+
+      etl::task* taskList[] = { &task1, &task2 };
+
+      etl::scheduler_work_stealing<2, 4> s;
+
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task_list(taskList, 2);
+      s.start();
+
+      CHECK_EQUAL(100U, task1.done);
+      CHECK_EQUAL(100U, task2.done);
+    }
+  };
+}
@@ -4041,6 +4041,105 @@ namespace
       CHECK_EQUAL(position1, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_long_strings)
+    {
+      // Long enough to be searched in blocks, with a small alphabet for many partial matches.
+      const value_t alphabet[] = { STR('a'), STR('b'), STR('c'), STR(' '), STR(','), value_t(0xE9) };
+      const size_t  alphabet_size = sizeof(alphabet) / sizeof(alphabet[0]);
+
+      etl::string<300> text;
+      Compare_Text     compare_text;
+      uint32_t         seed = 1U;
+
+      for (size_t length = 0UL; length < 300UL; length += 7UL)
+      {
+        text.clear();
+
+        for (size_t i = 0UL; i < length; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          text.push_back(alphabet[(seed >> 16U) % ((length % 3UL == 0UL) ? 3UL : alphabet_size)]);
+        }
+
+        compare_text.assign(text.begin(), text.end());
+
+        for (size_t position = 0UL; position <= length; position += 5UL)
+        {
+          for (size_t n = 0UL; n < 20UL; ++n)
+          {
+            // Needles from the text and from its end, so most are found.
+            const size_t start = (position + (n * 13UL)) % (length + 1UL);
+            const size_t count = etl::min(n, length - start);
+
+            const Compare_Text needle(compare_text, start, count);
+
+            // An empty string is not found at the end, unlike std::string.
+            if (!needle.empty() || (position < length))
+            {
+              CHECK_EQUAL(compare_text.find(needle, position), text.find(needle.c_str(), position, needle.size()));
+            }
+
+            CHECK_EQUAL(compare_text.find_first_of(needle, position), text.find_first_of(needle.c_str(), position, needle.size()));
+            CHECK_EQUAL(compare_text.find_last_of(needle, position), text.find_last_of(needle.c_str(), position, needle.size()));
+            CHECK_EQUAL(compare_text.find_first_not_of(needle, position), text.find_first_not_of(needle.c_str(), position, needle.size()));
+            CHECK_EQUAL(compare_text.find_last_not_of(needle, position), text.find_last_not_of(needle.c_str(), position, needle.size()));
+          }
+
+          for (size_t i = 0UL; i < alphabet_size; ++i)
+          {
+            CHECK_EQUAL(compare_text.find(alphabet[i], position), text.find(alphabet[i], position));
+            CHECK_EQUAL(compare_text.find_last_of(alphabet[i], position), text.find_last_of(alphabet[i], position));
+          }
+        }
+
+        for (size_t i = 0UL; i < alphabet_size; ++i)
+        {
+          CHECK_EQUAL(compare_text.rfind(alphabet[i]), text.rfind(alphabet[i]));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_position_out_of_range)
+    {
+      Text text(STR("Hello World"));
+      Text needle(STR("World"));
+      Text empty;
+
+      CHECK_EQUAL(Text::npos, text.find(needle, Text::npos));
+      CHECK_EQUAL(Text::npos, text.find(needle, text.size() + 1U));
+      CHECK_EQUAL(Text::npos, text.find(empty, Text::npos));
+      CHECK_EQUAL(Text::npos, text.find(needle.c_str(), Text::npos));
+      CHECK_EQUAL(Text::npos, text.find(needle.c_str(), Text::npos, needle.size()));
+      CHECK_EQUAL(Text::npos, text.find(STR('H'), Text::npos));
+      CHECK_EQUAL(Text::npos, text.find(STR('H'), text.size()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_compare_long_strings)
+    {
+      etl::string<100> text1(STR("The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog."));
+      Compare_Text     compare_text1(text1.begin(), text1.end());
+
+      for (size_t i = 0UL; i < text1.size(); ++i)
+      {
+        // A different character at each position, and every length.
+        etl::string<100> text2(text1);
+        text2[i] = STR('A');
+        Compare_Text compare_text2(text2.begin(), text2.end());
+
+        CHECK(compares_agree(compare_text1.compare(compare_text2), text1.compare(text2)));
+        CHECK(compares_agree(compare_text2.compare(compare_text1), text2.compare(text1)));
+
+        text2.assign(text1.begin(), text1.begin() + i);
+        compare_text2.assign(text2.begin(), text2.end());
+
+        CHECK(compares_agree(compare_text1.compare(compare_text2), text1.compare(text2)));
+        CHECK(compares_agree(compare_text2.compare(compare_text1), text2.compare(text1)));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_hash)
     {
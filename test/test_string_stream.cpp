@@ -214,6 +214,30 @@ namespace
       CHECK_EQUAL(String(STR("0x1e240")), ss.str());
     }
 
+    //*************************************************************************
+    TEST(test_custom_inline_format_floating_point_notation)
+    {
+      String str;
+      Stream ss(str);
+
+      double value = 12345.6789;
+
+      ss << etl::setprecision(2) << value;
+      CHECK_EQUAL(String(STR("12345.68")), ss.str());
+
+      ss.str().clear();
+      ss << etl::scientific << value;
+      CHECK_EQUAL(String(STR("1.23e+04")), ss.str());
+
+      ss.str().clear();
+      ss << etl::general << value;
+      CHECK_EQUAL(String(STR("12345.6789")), ss.str());
+
+      ss.str().clear();
+      ss << etl::fixed << value;
+      CHECK_EQUAL(String(STR("12345.68")), ss.str());
+    }
+
     //*************************************************************************
     TEST(test_custom_multi_inline_format)
     {
@@ -1252,6 +1252,20 @@ namespace
       CHECK(text.end() == itr);
     }
 
+    //*************************************************************************
+    TEST(test_find_of_many_delimiters)
+    {
+      String text(STR("The quick brown fox, jumps; over the lazy dog."));
+
+      const String::value_type* delimiters = STR(" ,;.!?:-()[]{}");
+
+      CHECK_EQUAL(STR(' '), *etl::find_first_of(text.begin(), text.end(), delimiters));
+      CHECK(text.begin() + 3 == etl::find_first_of(text.begin(), text.end(), delimiters));
+      CHECK(text.end() - 1 == etl::find_last_of(text.begin(), text.end(), delimiters));
+      CHECK(text.begin() == etl::find_first_not_of(text.begin(), text.end(), delimiters));
+      CHECK(text.end() - 2 == etl::find_last_not_of(text.begin(), text.end(), delimiters));
+    }
+
     //*************************************************************************
     TEST(test_find_first_of_string)
     {
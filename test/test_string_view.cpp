@@ -626,6 +626,21 @@ namespace
       CHECK(View::npos == view.find(s5, 0, 15));
     }
 
+    //*************************************************************************
+    TEST(test_find_position_out_of_range)
+    {
+      View view(text.c_str());
+      View v1("World");
+      View v2;
+
+      CHECK(View::npos == view.find(v1, View::npos));
+      CHECK(View::npos == view.find(v1, view.size() + 1U));
+      CHECK(View::npos == view.find(v2, View::npos));
+      CHECK(View::npos == view.find("World", View::npos));
+      CHECK(View::npos == view.find("World", View::npos, 5));
+      CHECK(View::npos == view.find('H', View::npos));
+    }
+
     //*************************************************************************
     TEST(test_rfind)
     {
@@ -876,6 +891,36 @@ namespace
       CHECK(View::npos == view.find_last_not_of(s6, 10, 8));
     }
 
+    //*************************************************************************
+    TEST(test_find_long_views)
+    {
+      // Longer than a search block, with the matches near the ends.
+      std::string long_text = std::string(100U, 'a') + "Hello World" + std::string(100U, 'b');
+      std::string needle    = "World";
+
+      View view(long_text.c_str(), long_text.size());
+
+      CHECK_EQUAL(long_text.find(needle), view.find(View(needle.c_str())));
+      CHECK_EQUAL(long_text.find(needle, 107U), view.find(View(needle.c_str()), 107U));
+      CHECK_EQUAL(long_text.find(needle, 108U), view.find(View(needle.c_str()), 108U));
+      CHECK_EQUAL(long_text.find_first_of("Wb"), view.find_first_of("Wb"));
+      CHECK_EQUAL(long_text.find_last_of("Wa"), view.find_last_of("Wa"));
+      CHECK_EQUAL(long_text.find_first_not_of("a"), view.find_first_not_of("a"));
+      CHECK_EQUAL(long_text.find_last_not_of("b"), view.find_last_not_of("b"));
+      CHECK_EQUAL(long_text.find_first_not_of("abcdefghijklmnopqrstuvwxyz"), view.find_first_not_of("abcdefghijklmnopqrstuvwxyz"));
+
+      std::string other_text = long_text;
+      other_text[150U] = 'c';
+
+      View other_view(other_text.c_str(), other_text.size());
+
+      CHECK(view != other_view);
+      CHECK(view < other_view);
+      CHECK(view.compare(other_view) < 0);
+      CHECK(other_view.compare(view) > 0);
+      CHECK(view.compare(View(long_text.c_str(), 150U)) > 0);
+    }
+
     //*************************************************************************
     TEST(test_hash)
     {
@@ -0,0 +1,360 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2021 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <limits>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "etl/to_arithmetic.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/wstring.h"
+
+namespace
+{
+  //***************************************************************************
+  template <typename T>
+  etl::to_arithmetic_result<T> parse(const char* text, int radix = 10)
+  {
+    return etl::to_arithmetic<T>(text, strlen(text), radix);
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  template <typename T>
+  bool same_bits(T lhs, T rhs)
+  {
+    return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+  }
+#endif
+
+  SUITE(test_to_arithmetic)
+  {
+    //*************************************************************************
+    TEST(test_integral_decimal)
+    {
+      CHECK_EQUAL(0,          parse<int>("0").value());
+      CHECK_EQUAL(123,        parse<int>("123").value());
+      CHECK_EQUAL(-123,       parse<int>("-123").value());
+      CHECK_EQUAL(123,        parse<int>("000000000000000000000123").value());
+      CHECK_EQUAL(12345678,   parse<int>("12345678").value());
+      CHECK_EQUAL(123456789,  parse<int>("123456789").value());
+      CHECK_EQUAL(-123456789, parse<int>("-123456789").value());
+
+      CHECK_EQUAL(INT8_MAX,   parse<int8_t>("127").value());
+      CHECK_EQUAL(INT8_MIN,   parse<int8_t>("-128").value());
+      CHECK_EQUAL(UINT8_MAX,  parse<uint8_t>("255").value());
+      CHECK_EQUAL(INT16_MAX,  parse<int16_t>("32767").value());
+      CHECK_EQUAL(INT16_MIN,  parse<int16_t>("-32768").value());
+      CHECK_EQUAL(UINT16_MAX, parse<uint16_t>("65535").value());
+      CHECK_EQUAL(INT32_MAX,  parse<int32_t>("2147483647").value());
+      CHECK_EQUAL(INT32_MIN,  parse<int32_t>("-2147483648").value());
+      CHECK_EQUAL(UINT32_MAX, parse<uint32_t>("4294967295").value());
+#if ETL_USING_64BIT_TYPES
+      CHECK_EQUAL(INT64_MAX,  parse<int64_t>("9223372036854775807").value());
+      CHECK_EQUAL(INT64_MIN,  parse<int64_t>("-9223372036854775808").value());
+      CHECK_EQUAL(UINT64_MAX, parse<uint64_t>("18446744073709551615").value());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_integral_overflow)
+    {
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<int8_t>("128").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<int8_t>("-129").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<uint8_t>("256").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<uint8_t>("12345678").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<int32_t>("2147483648").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<int32_t>("-2147483649").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<uint32_t>("4294967296").error());
+#if ETL_USING_64BIT_TYPES
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<int64_t>("9223372036854775808").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<uint64_t>("18446744073709551616").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<uint64_t>("123456789012345678901234567890").error());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_integral_invalid_format)
+    {
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("-").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("+1").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>(" 1").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("1 ").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("12345678x").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("1234x5678").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<unsigned>("-1").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("0x10").error());
+
+      CHECK(!parse<int>("1.5"));
+      CHECK_EQUAL(42, parse<int>("abc").value_or(42));
+    }
+
+    //*************************************************************************
+    TEST(test_integral_radix)
+    {
+      CHECK_EQUAL(5,          parse<int>("101", 2).value());
+      CHECK_EQUAL(-8,         parse<int>("-10", 8).value());
+      CHECK_EQUAL(0xABCD,     parse<int>("abcd", 16).value());
+      CHECK_EQUAL(0xABCD,     parse<int>("ABCD", 16).value());
+      CHECK_EQUAL(35,         parse<int>("z", 36).value());
+      CHECK_EQUAL(UINT32_MAX, parse<uint32_t>("ffffffff", 16).value());
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<int>("2", 2).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       parse<uint32_t>("100000000", 16).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Radix,  parse<int>("1", 1).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Radix,  parse<int>("1", 37).error());
+    }
+
+    //*************************************************************************
+    TEST(test_integral_compared_to_strtol)
+    {
+      std::mt19937 generator(1234);
+      std::uniform_int_distribution<int32_t> distribution(INT32_MIN, INT32_MAX);
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        const int32_t compare = distribution(generator) >> (i % 32);
+
+        char text[20];
+        snprintf(text, sizeof(text), "%ld", long(compare));
+
+        CHECK_EQUAL(compare, parse<int32_t>(text).value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars)
+    {
+      const char text[] = "1234567890123,456";
+
+      int32_t value = 99;
+      etl::from_chars_result<char> result = etl::from_chars(text, text + strlen(text), value);
+
+      // Overflow uses all of the digits and leaves the value alone.
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, result.status);
+      CHECK(result.ptr == text + 13);
+      CHECK_EQUAL(99, value);
+
+      result = etl::from_chars(result.ptr + 1, text + strlen(text), value);
+      CHECK_EQUAL(etl::to_arithmetic_status::Valid, result.status);
+      CHECK(result.ptr == text + strlen(text));
+      CHECK_EQUAL(456, value);
+
+      // No digits.
+      result = etl::from_chars(text + 13, text + strlen(text), value);
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, result.status);
+      CHECK(result.ptr == text + 13);
+      CHECK_EQUAL(456, value);
+    }
+
+    //*************************************************************************
+    TEST(test_string_types)
+    {
+      etl::string<20>    str("-1234");
+      etl::string_view   view(str);
+      etl::wstring<20>   wstr(L"98765432123");
+
+      CHECK_EQUAL(-1234, etl::to_arithmetic<int>(str).value());
+      CHECK_EQUAL(-1234, etl::to_arithmetic<int>(view).value());
+      CHECK_EQUAL(-12,   etl::to_arithmetic<int>(view.substr(0, 3)).value());
+      CHECK_EQUAL(98765432123LL, etl::to_arithmetic<long long>(wstr).value());
+      CHECK_EQUAL(123,   etl::to_arithmetic<int>(L"123", 3).value());
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      CHECK_EQUAL(0.0,      parse<double>("0").value());
+      CHECK_EQUAL(1.0,      parse<double>("1").value());
+      CHECK_EQUAL(-1.5,     parse<double>("-1.5").value());
+      CHECK_EQUAL(0.5,      parse<double>(".5").value());
+      CHECK_EQUAL(5.0,      parse<double>("5.").value());
+      CHECK_EQUAL(0.1,      parse<double>("0.1").value());
+      CHECK_EQUAL(1.25e10,  parse<double>("1.25e10").value());
+      CHECK_EQUAL(1.25e10,  parse<double>("1.25E+10").value());
+      CHECK_EQUAL(1.25e-10, parse<double>("1.25e-10").value());
+      CHECK_EQUAL(3.14159f, parse<float>("3.14159").value());
+      CHECK_EQUAL(static_cast<long double>(0.1), parse<long double>("0.1").value());
+
+      CHECK_EQUAL(std::numeric_limits<double>::max(),        parse<double>("1.7976931348623157e308").value());
+      CHECK_EQUAL(std::numeric_limits<double>::min(),        parse<double>("2.2250738585072014e-308").value());
+      CHECK_EQUAL(std::numeric_limits<double>::denorm_min(), parse<double>("4.9406564584124654e-324").value());
+      CHECK_EQUAL(std::numeric_limits<float>::max(),         parse<float>("3.4028235e38").value());
+      CHECK_EQUAL(std::numeric_limits<float>::denorm_min(),  parse<float>("1.4e-45").value());
+
+      // Negative zero.
+      CHECK(same_bits(-0.0, parse<double>("-0").value()));
+      CHECK(same_bits(-0.0, parse<double>("-0.0e10").value()));
+
+      // Too small for the type.
+      CHECK(same_bits(0.0,  parse<double>("1e-400").value()));
+      CHECK(same_bits(0.0f, parse<float>("1e-50").value()));
+      CHECK(same_bits(0.0,  parse<double>("1e-99999999999").value()));
+
+      // Too large for the type.
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<double>("1.8e308").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<double>("-1e99999999999").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, parse<float>("3.5e38").error());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_special_values)
+    {
+      CHECK_EQUAL(std::numeric_limits<double>::infinity(),  parse<double>("inf").value());
+      CHECK_EQUAL(-std::numeric_limits<double>::infinity(), parse<double>("-Infinity").value());
+      CHECK_EQUAL(std::numeric_limits<float>::infinity(),   parse<float>("INF").value());
+
+      const double nan = parse<double>("NaN").value();
+      CHECK(nan != nan);
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("infin").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("na").error());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_invalid_format)
+    {
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("-").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>(".").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("+1").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("e10").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("1.5x").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, parse<double>("1..5").error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Radix,  parse<double>("1", 16).error());
+
+      // An exponent without digits is not used.
+      const char text[] = "1.5e+";
+      double value = 0.0;
+      etl::from_chars_result<char> result = etl::from_chars(text, text + strlen(text), value);
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Valid, result.status);
+      CHECK(result.ptr == text + 3);
+      CHECK_EQUAL(1.5, value);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_many_digits)
+    {
+      // Exactly half way between 1 and the next double, then just above it.
+      const std::string halfway = "1.00000000000000011102230246251565404236316680908203125";
+
+      CHECK_EQUAL(1.0,                     parse<double>(halfway.c_str()).value());
+      CHECK_EQUAL(1.0000000000000002,      parse<double>((halfway + "000000000000000000000000000001").c_str()).value());
+      CHECK_EQUAL(1.0,                     parse<double>("0.99999999999999999999999999999999999999999").value());
+      CHECK_EQUAL(123.0,                   parse<double>("00000000000000000000000000000000123.000000000000000000000000").value());
+
+      // Half way between the largest subnormal and the smallest normal.
+      CHECK_EQUAL(std::numeric_limits<double>::min(),
+                  parse<double>("2.22507385850720113605740979670913197593481954635164564802342610972482222202107694551652952390813508791414915891303962110687008643869459464552765720740782062174337998814106326732925355228688137214901298112245145188984905722230728525513315575501591439747639798341180199932396254828901710708185069063066665599493827577257201576306269066333264756530000924588831643303777979186961204949739037782970490505108060994073026293712895895000358379996720725430436028407889577179615094551674824347103070260914462157228988025818254518032570701886087211312807951223342628836862232150377566662250398253433597456888442390026549819838548794829220689472168983109969836584681402285424333066033985088644580400103493397042756718644338377048603786162277173854562306587467901408672332763671875e-308").value());
+
+      // The smallest subnormal is rounded to from anything above half of it.
+      CHECK_EQUAL(std::numeric_limits<double>::denorm_min(),
+                  parse<double>("2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996189898282347722858865463328355177969898199387398005390939063150356595155702263922908583924491051844359318028499365361525003193704576782492193656236698636584807570015857692699037063119282795585513329278343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378573934507363390079677619305775067401763246736009689513405355374585166611342237666786041621596804619144672918403005300575308490487653917113865916462395249126236538818796362393732804238910186723484976682350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854513962138377228261454376934125320985913276672363281251e-324").value());
+
+      // Exactly half of it rounds to even, which is zero.
+      CHECK(same_bits(0.0, parse<double>("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324").value()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_round_trip)
+    {
+      std::mt19937_64 generator(5678);
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint64_t bits = generator();
+        double compare;
+        memcpy(&compare, &bits, sizeof(compare));
+
+        if ((compare != compare) || (compare - compare != 0.0))
+        {
+          continue;
+        }
+
+        char text[40];
+        snprintf(text, sizeof(text), "%.*g", (i % 17) + 1, compare);
+
+        CHECK(same_bits(strtod(text, ETL_NULLPTR), parse<double>(text).value()));
+
+        const float compare_float = float(compare);
+        snprintf(text, sizeof(text), "%.*g", (i % 9) + 1, double(compare_float));
+
+        CHECK(same_bits(strtof(text, ETL_NULLPTR), parse<float>(text).value()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_long_decimals)
+    {
+      std::mt19937_64 generator(91011);
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        uint64_t bits = generator();
+        double compare;
+        memcpy(&compare, &bits, sizeof(compare));
+
+        if ((compare != compare) || (compare - compare != 0.0))
+        {
+          continue;
+        }
+
+        // Enough digits to force the comparison with the half way point.
+        char text[1200];
+        snprintf(text, sizeof(text), "%.*e", 20 + (i % 800), compare);
+
+        CHECK(same_bits(strtod(text, ETL_NULLPTR), parse<double>(text).value()));
+
+        snprintf(text, sizeof(text), "%.*e", 20 + (i % 120), double(float(compare)));
+
+        CHECK(same_bits(strtof(text, ETL_NULLPTR), parse<float>(text).value()));
+
+        // Exactly half way to the next value, where long double can hold it.
+        if (std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits)
+        {
+          const long double halfway = (static_cast<long double>(compare) + static_cast<long double>(nextafter(compare, 0.0))) / 2;
+          snprintf(text, sizeof(text), "%.*Le", 780, halfway);
+
+          CHECK(same_bits(strtod(text, ETL_NULLPTR), parse<double>(text).value()));
+        }
+      }
+    }
+#endif
+  };
+}
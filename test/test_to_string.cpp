@@ -31,6 +31,11 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <limits>
+#include <random>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
 
 #include "etl/to_string.h"
 #include "etl/string.h"
@@ -253,6 +258,59 @@ namespace
       CHECK(etl::string<17>(STR("1e240")) ==              etl::to_string(123456, str, Format().hex()));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_and_hex_compared_to_ostream)
+    {
+      std::vector<uint64_t> values;
+
+      for (uint64_t power = 1U; power < (std::numeric_limits<uint64_t>::max() / 10U); power *= 10U)
+      {
+        values.push_back(power - 1U);
+        values.push_back(power);
+        values.push_back(power + 1U);
+      }
+
+      std::mt19937_64 urng(12345);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        values.push_back(urng() >> (i % 64));
+      }
+
+      values.push_back(std::numeric_limits<uint64_t>::max());
+
+      etl::string<80> str;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        const uint64_t value = values[i];
+
+        std::ostringstream oss;
+        oss << value << ' ' << int64_t(value) << ' ' << int32_t(value) << ' ' << uint32_t(value);
+        std::string temp(oss.str());
+        etl::string<80> compare(temp.begin(), temp.end());
+
+        to_string(value,           str, Format());
+        str.push_back(STR(' '));
+        to_string(int64_t(value),  str, Format(), true);
+        str.push_back(STR(' '));
+        to_string(int32_t(value),  str, Format(), true);
+        str.push_back(STR(' '));
+        to_string(uint32_t(value), str, Format(), true);
+        CHECK(compare == str);
+
+        oss.str(STR(""));
+        oss << std::hex << value << ' ' << std::uppercase << std::showbase << uint32_t(value);
+        temp = oss.str();
+        compare.assign(temp.begin(), temp.end());
+
+        to_string(value,           str, Format().hex());
+        str.push_back(STR(' '));
+        to_string(uint32_t(value), str, Format().hex().upper_case(true).show_base(true), true);
+        CHECK(compare == str);
+      }
+    }
+
     //*************************************************************************
     TEST(test_floating_point_no_append)
     {
@@ -326,6 +384,125 @@ namespace
       CHECK(etl::string<20>(STR("20.0")) ==    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_large_values)
+    {
+      etl::string<40> str;
+
+      CHECK(etl::string<40>(STR("4294967296.50")) ==        etl::to_string(4294967296.5, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("-12345678901234.000")) ==  etl::to_string(-12345678901234.0, str, Format().precision(3)));
+      CHECK(etl::string<40>(STR("100000000000000000000")) == etl::to_string(1e20, str, Format()));
+      CHECK(etl::string<40>(STR("0.000000000123")) ==       etl::to_string(1.23e-10, str, Format().precision(12)));
+      CHECK(etl::string<40>(STR("0.00")) ==                 etl::to_string(1.23e-10, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("1.22999999999999998224")) == etl::to_string(1.23, str, Format().precision(20)));
+      CHECK(etl::string<40>(STR("2.67")) ==                 etl::to_string(2.675, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("1000.0")) ==               etl::to_string(999.96, str, Format().precision(1)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_rounds_exact_value)
+    {
+      etl::string<40> str;
+
+      // The shortest digits end in 5 at the cut, but the values are below half way.
+      CHECK(etl::string<40>(STR("896626.615226")) ==   etl::to_string(896626.61522649997, str, Format().precision(6)));
+      CHECK(etl::string<40>(STR("-674779.283282")) ==  etl::to_string(-674779.28328249999, str, Format().precision(6)));
+      CHECK(etl::string<40>(STR("990286.444052")) ==   etl::to_string(990286.44405249995, str, Format().precision(6)));
+      CHECK(etl::string<40>(STR("8.96626615226e+05")) == etl::to_string(896626.61522649997, str, Format().scientific().precision(11)));
+
+      // The shortest digits end before the precision, but are not exact to it.
+      CHECK(etl::string<40>(STR("278049297041461.88")) ==     etl::to_string(278049297041461.875, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("0.1000000000000000055511151")) == etl::to_string(0.1, str, Format().precision(25)));
+      CHECK(etl::string<40>(STR("1.0000e+23")) ==             etl::to_string(9.9999999999999991e22, str, Format().scientific().precision(4)));
+
+      // Exact ties round away from zero.
+      CHECK(etl::string<40>(STR("0.13")) ==            etl::to_string(0.125, str, Format().precision(2)));
+      CHECK(etl::string<40>(STR("-3")) ==              etl::to_string(-2.5, str, Format().precision(0)));
+      CHECK(etl::string<40>(STR("1.3e+00")) ==         etl::to_string(1.25, str, Format().scientific().precision(1)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_scientific)
+    {
+      etl::string<40> str;
+
+      CHECK(etl::string<40>(STR("0.000000e+00")) ==  etl::to_string(0.0, str, Format().scientific().precision(6)));
+      CHECK(etl::string<40>(STR("1.234568e+05")) ==  etl::to_string(123456.789, str, Format().scientific().precision(6)));
+      CHECK(etl::string<40>(STR("-1.23E-10")) ==     etl::to_string(-1.234e-10, str, Format().scientific().precision(2).upper_case(true)));
+      CHECK(etl::string<40>(STR("1e+01")) ==         etl::to_string(9.6, str, Format().scientific()));
+      CHECK(etl::string<40>(STR("1.797693e+308")) == etl::to_string(1.7976931348623157e308, str, Format().scientific().precision(6)));
+      CHECK(etl::string<40>(STR("4.940656e-324")) == etl::to_string(4.9406564584124654e-324, str, Format().scientific().precision(6)));
+      CHECK(etl::string<40>(STR("  1.50e+00")) ==    etl::to_string(1.5, str, Format().scientific().precision(2).width(10)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_subnormal_and_extreme_values)
+    {
+      etl::string<40>  str;
+      etl::string<400> long_str;
+
+      CHECK(etl::string<40>(STR("4.941e-324")) ==       etl::to_string(5e-324, str, Format().scientific().precision(3)));
+      CHECK(etl::string<40>(STR("2.2250738585e-308")) == etl::to_string(2.2250738585072014e-308, str, Format().scientific().precision(10)));
+      CHECK(etl::string<40>(STR("1.401e-45")) ==        etl::to_string(1.401298464324817e-45f, str, Format().scientific().precision(3)));
+      CHECK(etl::string<40>(STR("-4.941e-324")) ==      etl::to_string(-5e-324, str, Format().scientific().precision(3)));
+      CHECK(etl::string<40>(STR("0.000")) ==            etl::to_string(5e-324, str, Format().precision(3)));
+
+      const etl::string<400> dbl_max(STR("179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368.0"));
+
+      CHECK(dbl_max == etl::to_string(1.7976931348623157e308, long_str, Format().precision(1)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_general)
+    {
+      etl::string<40> str;
+
+      CHECK(etl::string<40>(STR("0")) ==                       etl::to_string(0.0, str, Format().general()));
+      CHECK(etl::string<40>(STR("1")) ==                       etl::to_string(1.0, str, Format().general()));
+      CHECK(etl::string<40>(STR("0.1")) ==                     etl::to_string(0.1, str, Format().general()));
+      CHECK(etl::string<40>(STR("-123.456")) ==                etl::to_string(-123.456, str, Format().general()));
+      CHECK(etl::string<40>(STR("0.0001")) ==                  etl::to_string(0.0001, str, Format().general()));
+      CHECK(etl::string<40>(STR("1e-05")) ==                   etl::to_string(0.00001, str, Format().general()));
+      CHECK(etl::string<40>(STR("12345678901234568")) ==       etl::to_string(12345678901234567.0, str, Format().general()));
+      CHECK(etl::string<40>(STR("1e+17")) ==                   etl::to_string(1e17, str, Format().general()));
+      CHECK(etl::string<40>(STR("1.7976931348623157e+308")) == etl::to_string(1.7976931348623157e308, str, Format().general()));
+      CHECK(etl::string<40>(STR("5e-324")) ==                  etl::to_string(4.9406564584124654e-324, str, Format().general()));
+      CHECK(etl::string<40>(STR("0.3")) ==                     etl::to_string(0.3f, str, Format().general()));
+      CHECK(etl::string<40>(STR("3.4028235e+38")) ==           etl::to_string(3.4028235e38f, str, Format().general()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_general_round_trip)
+    {
+      std::mt19937_64 urng(12345);
+
+      etl::string<40> str;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const uint64_t bits = urng();
+
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+
+        if (!isnan(d) && !isinf(d))
+        {
+          etl::to_string(d, str, Format().general());
+          CHECK_EQUAL(d, strtod(str.c_str(), ETL_NULLPTR));
+        }
+
+        float f;
+        const uint32_t bits32 = uint32_t(bits >> 32U);
+        memcpy(&f, &bits32, sizeof(f));
+
+        if (!isnan(f) && !isinf(f))
+        {
+          etl::to_string(f, str, Format().general());
+          CHECK_EQUAL(f, strtof(str.c_str(), ETL_NULLPTR));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
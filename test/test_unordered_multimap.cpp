@@ -34,6 +34,7 @@ SOFTWARE.
 #include <utility>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <numeric>
 #include <functional>
@@ -804,5 +805,92 @@ namespace
       CHECK_EQUAL("map[2] = c", s[0]);
       CHECK_EQUAL("map[3] = d", s[1]);
     }
+
+    //*************************************************************************
+    struct transparent_hash
+    {
+      typedef int is_transparent;
+
+      size_t operator ()(std::string_view text) const
+      {
+        return std::hash<std::string_view>()(text);
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      using Transparent = etl::unordered_multimap<std::string, int, SIZE, SIZE / 2, transparent_hash, etl::equal_to<>>;
+
+      Transparent data;
+      data.insert(ETL_OR_STD::make_pair(std::string("1"), 1));
+      data.insert(ETL_OR_STD::make_pair(std::string("3"), 3));
+      data.insert(ETL_OR_STD::make_pair(std::string("3"), 4));
+      data.insert(ETL_OR_STD::make_pair(std::string("5"), 5));
+
+      const Transparent& cdata = data;
+
+      CHECK_EQUAL("3", data.find(std::string_view("3"))->first);
+      CHECK_EQUAL(5, cdata.find(std::string_view("5"))->second);
+      CHECK(data.end() == data.find(std::string_view("4")));
+      CHECK_EQUAL(2U, data.count(std::string_view("3")));
+      CHECK_EQUAL(0U, cdata.count(std::string_view("2")));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range(std::string_view("3"));
+      CHECK_EQUAL(2, std::distance(range.first, range.second));
+      CHECK_EQUAL(7, range.first->second + (++range.first)->second);
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range(std::string_view("4"));
+      CHECK(crange.first == crange.second);
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_sparse_buckets)
+    {
+      typedef etl::unordered_multimap<int, int, 8, 1000> Sparse;
+
+      const int keys[] = { 999, 3, 500, 64, 65, 1, 500 };
+      const size_t nkeys = sizeof(keys) / sizeof(keys[0]);
+
+      Sparse data;
+
+      for (size_t i = 0UL; i < nkeys; ++i)
+      {
+        data.insert(ETL_OR_STD::make_pair(keys[i], keys[i] * 2));
+      }
+
+      std::vector<int> expected(keys, keys + nkeys);
+      std::sort(expected.begin(), expected.end());
+
+      std::vector<int> actual;
+
+      for (Sparse::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        actual.push_back(itr->first);
+      }
+
+      std::sort(actual.begin(), actual.end());
+      CHECK(expected == actual);
+
+      // Erasing the element at begin() must move begin() to the next occupied bucket.
+      data.erase(data.begin());
+      CHECK_EQUAL(nkeys - 1, data.size());
+      CHECK_EQUAL(nkeys - 1, size_t(std::distance(data.begin(), data.end())));
+
+      // Erase from the middle to the end.
+      Sparse::iterator middle = data.begin();
+      std::advance(middle, 2);
+      data.erase(middle, data.end());
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(2U, size_t(std::distance(data.begin(), data.end())));
+
+      data.clear();
+      CHECK(data.begin() == data.end());
+
+      data.insert(ETL_OR_STD::make_pair(42, 84));
+      Sparse::iterator itr = data.begin();
+      CHECK_EQUAL(42, itr->first);
+      CHECK(++itr == data.end());
+    }
   };
 }